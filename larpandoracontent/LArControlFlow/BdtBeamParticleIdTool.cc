@@ -12,8 +12,10 @@
 
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
-#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
+
+#include <memory>
 
 using namespace pandora;
 
@@ -29,7 +31,8 @@ BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
     m_maxNeutrinos(std::numeric_limits<int>::max()),
     m_minAdaBDTScore(0.f),
-    m_sliceFeatureParameters(SliceFeatureParameters())
+    m_sliceFeatureParameters(SliceFeatureParameters()),
+    m_nSliceFeatureThreads(1)
 {
 }
 
@@ -130,8 +133,17 @@ void BdtBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *const pAl
 void BdtBeamParticleIdTool::GetSliceFeatures(
     const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const
 {
-    for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
-        sliceFeaturesVector.push_back(SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), m_sliceFeatureParameters));
+    const unsigned int nSlices(nuSliceHypotheses.size());
+    std::vector<std::unique_ptr<SliceFeatures>> sliceFeaturesPtrVector(nSlices);
+
+    // ATTN Slice feature calculation only reads the slice hypotheses, so slices can be processed concurrently
+    LArThreadingHelper::ParallelFor(nSlices, m_nSliceFeatureThreads, [&](const unsigned int sliceIndex) {
+        sliceFeaturesPtrVector.at(sliceIndex) =
+            std::make_unique<SliceFeatures>(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), m_sliceFeatureParameters);
+    });
+
+    for (const std::unique_ptr<SliceFeatures> &pSliceFeatures : sliceFeaturesPtrVector)
+        sliceFeaturesVector.push_back(*pSliceFeatures);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -299,11 +311,18 @@ bool BdtBeamParticleIdTool::PassesQualityCuts(const float purity, const float co
 void BdtBeamParticleIdTool::SelectPfosByAdaBDTScore(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
+    const unsigned int nSlices(nuSliceHypotheses.size());
+    FloatVector nuAdaBDTScores(nSlices, 0.f);
+
+    LArThreadingHelper::ParallelFor(nSlices, m_nSliceFeatureThreads, [&](const unsigned int sliceIndex) {
+        nuAdaBDTScores.at(sliceIndex) = sliceFeaturesVector.at(sliceIndex).GetAdaBoostDecisionTreeScore(m_adaBoostDecisionTree);
+    });
+
     // Calculate the probability of each slice that passes the minimum probability cut
     std::vector<UintFloatPair> sliceIndexAdaBDTScorePairs;
-    for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuAdaBDTScore(sliceFeaturesVector.at(sliceIndex).GetAdaBoostDecisionTreeScore(m_adaBoostDecisionTree));
+        const float nuAdaBDTScore(nuAdaBDTScores.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -436,11 +455,8 @@ BdtBeamParticleIdTool::SliceFeatures::SliceFeatures(const PfoList &pfosNu, const
 {
     try
     {
-        double closestDistanceNu(std::numeric_limits<double>::max()), closestDistanceCr(std::numeric_limits<double>::max()),
-            supplementaryAngleToBeamNu(std::numeric_limits<double>::max()), supplementaryAngleToBeamCr(std::numeric_limits<double>::max()),
-            separationNu(std::numeric_limits<double>::max()), separationCr(std::numeric_limits<double>::max());
-        ;
-        CaloHitList caloHitList3DNu, caloHitList3DCr, selectedCaloHitListNu, selectedCaloHitListCr;
+        double closestDistanceNu(std::numeric_limits<double>::max()), closestDistanceCr(std::numeric_limits<double>::max());
+        CaloHitList caloHitList3DNu, caloHitList3DCr;
         PfoList allConnectedPfoListNu, allConnectedPfoListCr;
         LArPcaHelper::EigenValues eigenValuesNu(0.f, 0.f, 0.f);
         LArPcaHelper::EigenValues eigenValuesCr(0.f, 0.f, 0.f);
@@ -450,69 +466,50 @@ BdtBeamParticleIdTool::SliceFeatures::SliceFeatures(const PfoList &pfosNu, const
         LArPfoHelper::GetCaloHits(allConnectedPfoListNu, TPC_3D, caloHitList3DNu);
         LArPfoHelper::GetCaloHits(allConnectedPfoListCr, TPC_3D, caloHitList3DCr);
 
-        this->GetLeadingCaloHits(caloHitList3DNu, selectedCaloHitListNu, closestDistanceNu);
-        this->GetLeadingCaloHits(caloHitList3DCr, selectedCaloHitListCr, closestDistanceCr);
-
-        if (!selectedCaloHitListNu.empty() && !selectedCaloHitListCr.empty())
-        {
-            float maxYNu(-std::numeric_limits<float>::max()), maxYCr(-std::numeric_limits<float>::max());
-            CartesianVector centroidNu(0.f, 0.f, 0.f), interceptOneNu(0.f, 0.f, 0.f), interceptTwoNu(0.f, 0.f, 0.f),
-                centroidCr(0.f, 0.f, 0.f), interceptOneCr(0.f, 0.f, 0.f), interceptTwoCr(0.f, 0.f, 0.f);
-
-            // Beam
-            LArPcaHelper::EigenVectors eigenVecsNu;
-            LArPcaHelper::RunPca(selectedCaloHitListNu, centroidNu, eigenValuesNu, eigenVecsNu);
-            const CartesianVector &majorAxisNu(eigenVecsNu.front());
-            supplementaryAngleToBeamNu = majorAxisNu.GetOpeningAngle(m_sliceFeatureParameters.GetBeamDirection());
-
-            this->GetLArTPCIntercepts(centroidNu, majorAxisNu, interceptOneNu, interceptTwoNu);
-            const double separationOneNu((interceptOneNu - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
-            const double separationTwoNu((interceptTwoNu - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
-            separationNu = std::min(separationOneNu, separationTwoNu);
-
-            // Cosmic
-            LArPcaHelper::EigenVectors eigenVecsCr;
-            LArPcaHelper::RunPca(selectedCaloHitListCr, centroidCr, eigenValuesCr, eigenVecsCr);
-            const CartesianVector &majorAxisCr(eigenVecsCr.front());
-            supplementaryAngleToBeamCr = majorAxisCr.GetOpeningAngle(m_sliceFeatureParameters.GetBeamDirection());
-
-            this->GetLArTPCIntercepts(centroidCr, majorAxisCr, interceptOneCr, interceptTwoCr);
-            const double separationOneCr((interceptOneCr - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
-            const double separationTwoCr((interceptTwoCr - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
-            separationCr = std::min(separationOneCr, separationTwoCr);
-
-            for (const CaloHit *pCaloHit : caloHitList3DNu)
-            {
-                if (maxYNu < pCaloHit->GetPositionVector().GetY())
-                    maxYNu = pCaloHit->GetPositionVector().GetY();
-            }
-
-            for (const CaloHit *pCaloHit : caloHitList3DCr)
-            {
-                if (maxYCr < pCaloHit->GetPositionVector().GetY())
-                    maxYCr = pCaloHit->GetPositionVector().GetY();
-            }
-
-            m_featureVector.push_back(closestDistanceNu);
-            m_featureVector.push_back(supplementaryAngleToBeamNu);
-            m_featureVector.push_back(separationNu);
-            m_featureVector.push_back(eigenValuesNu.GetX());
-            m_featureVector.push_back(eigenValuesNu.GetY());
-            m_featureVector.push_back(eigenValuesNu.GetZ());
-            m_featureVector.push_back(maxYNu);
-            m_featureVector.push_back(allConnectedPfoListNu.size());
-
-            m_featureVector.push_back(closestDistanceCr);
-            m_featureVector.push_back(supplementaryAngleToBeamCr);
-            m_featureVector.push_back(separationCr);
-            m_featureVector.push_back(eigenValuesCr.GetX());
-            m_featureVector.push_back(eigenValuesCr.GetY());
-            m_featureVector.push_back(eigenValuesCr.GetZ());
-            m_featureVector.push_back(maxYCr);
-            m_featureVector.push_back(allConnectedPfoListCr.size());
-
-            m_isAvailable = true;
-        }
+        float maxYNu(-std::numeric_limits<float>::max()), maxYCr(-std::numeric_limits<float>::max());
+        CartesianVector centroidNu(0.f, 0.f, 0.f), interceptOneNu(0.f, 0.f, 0.f), interceptTwoNu(0.f, 0.f, 0.f), centroidCr(0.f, 0.f, 0.f),
+            interceptOneCr(0.f, 0.f, 0.f), interceptTwoCr(0.f, 0.f, 0.f);
+        LArPcaHelper::EigenVectors eigenVecsNu, eigenVecsCr;
+
+        // Beam
+        this->AnalyseLeadingCaloHits(caloHitList3DNu, closestDistanceNu, maxYNu, centroidNu, eigenValuesNu, eigenVecsNu);
+        const CartesianVector &majorAxisNu(eigenVecsNu.front());
+        const double supplementaryAngleToBeamNu(majorAxisNu.GetOpeningAngle(m_sliceFeatureParameters.GetBeamDirection()));
+
+        this->GetLArTPCIntercepts(centroidNu, majorAxisNu, interceptOneNu, interceptTwoNu);
+        const double separationOneNu((interceptOneNu - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
+        const double separationTwoNu((interceptTwoNu - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
+        const double separationNu(std::min(separationOneNu, separationTwoNu));
+
+        // Cosmic
+        this->AnalyseLeadingCaloHits(caloHitList3DCr, closestDistanceCr, maxYCr, centroidCr, eigenValuesCr, eigenVecsCr);
+        const CartesianVector &majorAxisCr(eigenVecsCr.front());
+        const double supplementaryAngleToBeamCr(majorAxisCr.GetOpeningAngle(m_sliceFeatureParameters.GetBeamDirection()));
+
+        this->GetLArTPCIntercepts(centroidCr, majorAxisCr, interceptOneCr, interceptTwoCr);
+        const double separationOneCr((interceptOneCr - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
+        const double separationTwoCr((interceptTwoCr - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitude());
+        const double separationCr(std::min(separationOneCr, separationTwoCr));
+
+        m_featureVector.push_back(closestDistanceNu);
+        m_featureVector.push_back(supplementaryAngleToBeamNu);
+        m_featureVector.push_back(separationNu);
+        m_featureVector.push_back(eigenValuesNu.GetX());
+        m_featureVector.push_back(eigenValuesNu.GetY());
+        m_featureVector.push_back(eigenValuesNu.GetZ());
+        m_featureVector.push_back(maxYNu);
+        m_featureVector.push_back(allConnectedPfoListNu.size());
+
+        m_featureVector.push_back(closestDistanceCr);
+        m_featureVector.push_back(supplementaryAngleToBeamCr);
+        m_featureVector.push_back(separationCr);
+        m_featureVector.push_back(eigenValuesCr.GetX());
+        m_featureVector.push_back(eigenValuesCr.GetY());
+        m_featureVector.push_back(eigenValuesCr.GetZ());
+        m_featureVector.push_back(maxYCr);
+        m_featureVector.push_back(allConnectedPfoListCr.size());
+
+        m_isAvailable = true;
     }
     catch (const StatusCodeException &)
     {
@@ -522,47 +519,89 @@ BdtBeamParticleIdTool::SliceFeatures::SliceFeatures(const PfoList &pfosNu, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void BdtBeamParticleIdTool::SliceFeatures::GetLeadingCaloHits(
-    const CaloHitList &inputCaloHitList, CaloHitList &outputCaloHitList, double &closestHitToFaceDistance) const
+void BdtBeamParticleIdTool::SliceFeatures::AnalyseLeadingCaloHits(const CaloHitList &inputCaloHitList, double &closestHitToFaceDistance,
+    float &maxY, CartesianVector &centroid, LArPcaHelper::EigenValues &eigenValues, LArPcaHelper::EigenVectors &eigenVectors) const
 {
     if (inputCaloHitList.empty())
     {
-        std::cout << "BdtBeamParticleIdTool::SliceFeatures::GetLeadingCaloHits - empty calo hit list" << std::endl;
+        std::cout << "BdtBeamParticleIdTool::SliceFeatures::AnalyseLeadingCaloHits - empty calo hit list" << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
 
     typedef std::pair<const CaloHit *, float> HitDistancePair;
     typedef std::vector<HitDistancePair> HitDistanceVector;
     HitDistanceVector hitDistanceVector;
+    hitDistanceVector.reserve(inputCaloHitList.size());
 
     for (const CaloHit *const pCaloHit : inputCaloHitList)
-        hitDistanceVector.emplace_back(
-            pCaloHit, (pCaloHit->GetPositionVector() - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitudeSquared());
+    {
+        const CartesianVector &position(pCaloHit->GetPositionVector());
+        hitDistanceVector.emplace_back(pCaloHit, (position - m_sliceFeatureParameters.GetBeamLArTPCIntersection()).GetMagnitudeSquared());
+
+        if (maxY < position.GetY())
+            maxY = position.GetY();
+    }
 
-    std::sort(hitDistanceVector.begin(), hitDistanceVector.end(),
-        [](const HitDistancePair &lhs, const HitDistancePair &rhs) -> bool { return (lhs.second < rhs.second); });
+    const unsigned int nInputHits(inputCaloHitList.size());
+    const unsigned int nSelectedCaloHits(
+        nInputHits < m_sliceFeatureParameters.GetNSelectedHits()
+            ? nInputHits
+            : static_cast<unsigned int>(std::ceil(static_cast<float>(nInputHits) * m_sliceFeatureParameters.GetSelectedFraction() / 100.f)));
+
+    // At least one hit is always selected. Only the selected hits need ordering, so partition them out before sorting
+    const unsigned int nLeadingHits(std::min(nInputHits, std::max(1u, nSelectedCaloHits)));
+    const HitDistanceVector::iterator leadingEnd(hitDistanceVector.begin() + nLeadingHits);
+    auto sortByDistance = [](const HitDistancePair &lhs, const HitDistancePair &rhs) -> bool { return (lhs.second < rhs.second); };
+
+    if (hitDistanceVector.end() != leadingEnd)
+        std::nth_element(hitDistanceVector.begin(), leadingEnd, hitDistanceVector.end(), sortByDistance);
+
+    std::sort(hitDistanceVector.begin(), leadingEnd, sortByDistance);
 
     if (hitDistanceVector.front().second < 0.f)
     {
-        std::cout << "BdtBeamParticleIdTool::SliceFeatures::GetLeadingCaloHits - unphysical magnitude of a vector" << std::endl;
+        std::cout << "BdtBeamParticleIdTool::SliceFeatures::AnalyseLeadingCaloHits - unphysical magnitude of a vector" << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
     }
 
     closestHitToFaceDistance = std::sqrt(hitDistanceVector.front().second);
 
-    const unsigned int nInputHits(inputCaloHitList.size());
-    const unsigned int nSelectedCaloHits(
-        nInputHits < m_sliceFeatureParameters.GetNSelectedHits()
-            ? nInputHits
-            : static_cast<unsigned int>(std::ceil(static_cast<float>(nInputHits) * m_sliceFeatureParameters.GetSelectedFraction() / 100.f)));
+    // ATTN Unit weight sums, accumulated in increasing distance order as by LArPcaHelper::RunPca over the selected hits, so the results match
+    double meanPosition[3] = {0., 0., 0.};
+    double sumWeight(0.);
+
+    for (HitDistanceVector::const_iterator iter = hitDistanceVector.begin(); iter != leadingEnd; ++iter)
+    {
+        const CartesianVector &position(iter->first->GetPositionVector());
+        meanPosition[0] += static_cast<double>(position.GetX());
+        meanPosition[1] += static_cast<double>(position.GetY());
+        meanPosition[2] += static_cast<double>(position.GetZ());
+        sumWeight += 1.;
+    }
 
-    for (const HitDistancePair &hitDistancePair : hitDistanceVector)
+    meanPosition[0] /= sumWeight;
+    meanPosition[1] /= sumWeight;
+    meanPosition[2] /= sumWeight;
+    centroid = CartesianVector(meanPosition[0], meanPosition[1], meanPosition[2]);
+
+    LArPcaHelper::SecondMoments secondMoments = {0., 0., 0., 0., 0., 0.};
+
+    for (HitDistanceVector::const_iterator iter = hitDistanceVector.begin(); iter != leadingEnd; ++iter)
     {
-        outputCaloHitList.push_back(hitDistancePair.first);
+        const CartesianVector &position(iter->first->GetPositionVector());
+        const double x(static_cast<double>(position.GetX() - meanPosition[0]));
+        const double y(static_cast<double>(position.GetY() - meanPosition[1]));
+        const double z(static_cast<double>(position.GetZ() - meanPosition[2]));
 
-        if (outputCaloHitList.size() >= nSelectedCaloHits)
-            break;
+        secondMoments[0] += x * x;
+        secondMoments[1] += x * y;
+        secondMoments[2] += x * z;
+        secondMoments[3] += y * y;
+        secondMoments[4] += y * z;
+        secondMoments[5] += z * z;
     }
+
+    LArPcaHelper::RunPca(secondMoments, sumWeight, eigenValues, eigenVectors);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -732,6 +771,9 @@ StatusCode BdtBeamParticleIdTool::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaximumNeutrinos", m_maxNeutrinos));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceFeatureThreads", m_nSliceFeatureThreads));
+
     // Geometry Information for training
     FloatVector beamLArTPCIntersection;
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
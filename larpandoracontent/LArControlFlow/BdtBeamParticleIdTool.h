@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
 
@@ -267,14 +268,19 @@ private:
 
     private:
         /**
-         *  @brief  Select a given fraction of a slice's calo hits that are closest to the beam spot
+         *  @brief  Select a given fraction of a slice's calo hits that are closest to the beam spot, using a partial selection, and run a
+         *          principal component analysis of the selected hits. The maximum y coordinate of all the slice's calo hits is found in the
+         *          distance pass, and the centroid of the selected hits in the selection pass
          *
          *  @param  inputCaloHitList all calo hits in slice
-         *  @param  outputCaloHitList to receive the list of selected calo hits
          *  @param  closestHitToFaceDistance to receive the distance of closest hit to beam spot
+         *  @param  maxY to receive the maximum y coordinate of all calo hits in slice
+         *  @param  centroid to receive the centroid of the selected calo hits
+         *  @param  eigenValues to receive the eigen values of the selected calo hits
+         *  @param  eigenVectors to receive the eigen vectors of the selected calo hits
          */
-        void GetLeadingCaloHits(
-            const pandora::CaloHitList &inputCaloHitList, pandora::CaloHitList &outputCaloHitList, double &closestHitToFaceDistance) const;
+        void AnalyseLeadingCaloHits(const pandora::CaloHitList &inputCaloHitList, double &closestHitToFaceDistance, float &maxY,
+            pandora::CartesianVector &centroid, LArPcaHelper::EigenValues &eigenValues, LArPcaHelper::EigenVectors &eigenVectors) const;
 
         /**
          *  @brief  Find the intercepts of a line with the protoDUNE detector
@@ -398,6 +404,7 @@ private:
     unsigned int m_maxNeutrinos;                     ///< The maximum number of neutrinos to select in any one event
     float m_minAdaBDTScore;                          ///< Minimum score required to classify a slice as a beam particle
     SliceFeatureParameters m_sliceFeatureParameters; ///< Geometry information block
+    unsigned int m_nSliceFeatureThreads;             ///< The maximum number of threads with which to calculate slice features and scores
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -17,9 +17,12 @@
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include <memory>
+
 using namespace pandora;
 
 namespace lar_content
@@ -35,6 +38,7 @@ NeutrinoIdTool<T>::NeutrinoIdTool() :
     m_minProbability(0.0f),
     m_maxNeutrinos(1),
     m_persistFeatures(false),
+    m_nSliceFeatureThreads(1),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH")
 {
 }
@@ -87,8 +91,17 @@ template <typename T>
 void NeutrinoIdTool<T>::GetSliceFeatures(const NeutrinoIdTool<T> *const pTool, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, SliceFeaturesVector &sliceFeaturesVector) const
 {
-    for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
-        sliceFeaturesVector.push_back(SliceFeatures(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool));
+    const unsigned int nSlices(nuSliceHypotheses.size());
+    std::vector<std::unique_ptr<SliceFeatures>> sliceFeaturesPtrVector(nSlices);
+
+    // ATTN Slice feature calculation only reads the slice hypotheses, so slices can be processed concurrently
+    LArThreadingHelper::ParallelFor(nSlices, m_nSliceFeatureThreads, [&](const unsigned int sliceIndex) {
+        sliceFeaturesPtrVector.at(sliceIndex) =
+            std::make_unique<SliceFeatures>(nuSliceHypotheses.at(sliceIndex), crSliceHypotheses.at(sliceIndex), pTool);
+    });
+
+    for (const std::unique_ptr<SliceFeatures> &pSliceFeatures : sliceFeaturesPtrVector)
+        sliceFeaturesVector.push_back(*pSliceFeatures);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -246,11 +259,18 @@ template <typename T>
 void NeutrinoIdTool<T>::SelectPfosByProbability(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses,
     const SliceHypotheses &crSliceHypotheses, const SliceFeaturesVector &sliceFeaturesVector, PfoList &selectedPfos) const
 {
+    const unsigned int nSlices(nuSliceHypotheses.size());
+    FloatVector nuProbabilities(nSlices, 0.f);
+
+    LArThreadingHelper::ParallelFor(nSlices, m_nSliceFeatureThreads, [&](const unsigned int sliceIndex) {
+        nuProbabilities.at(sliceIndex) = sliceFeaturesVector.at(sliceIndex).GetNeutrinoProbability(m_mva);
+    });
+
     // Calculate the probability of each slice that passes the minimum probability cut
     std::vector<UintFloatPair> sliceIndexProbabilityPairs;
-    for (unsigned int sliceIndex = 0, nSlices = nuSliceHypotheses.size(); sliceIndex < nSlices; ++sliceIndex)
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
     {
-        const float nuProbability(sliceFeaturesVector.at(sliceIndex).GetNeutrinoProbability(m_mva));
+        const float nuProbability(nuProbabilities.at(sliceIndex));
 
         for (const ParticleFlowObject *const pPfo : crSliceHypotheses.at(sliceIndex))
         {
@@ -341,39 +361,40 @@ NeutrinoIdTool<T>::SliceFeatures::SliceFeatures(const PfoList &nuPfos, const Pfo
         CartesianVector nuWeightedDirTotal(0.f, 0.f, 0.f);
         unsigned int nuNHitsUsedTotal(0);
         unsigned int nuNHitsTotal(0);
-        CartesianPointVector nuAllSpacePoints;
+        ClusterVector nuClusters3D;
+        CartesianPointVector spacePoints;
         for (const ParticleFlowObject *const pPfo : nuFinalStates)
         {
-            CartesianPointVector spacePoints;
-            this->GetSpacePoints(pPfo, spacePoints);
+            const Cluster *const pCluster3D(this->GetThreeDCluster(pPfo));
 
-            nuAllSpacePoints.insert(nuAllSpacePoints.end(), spacePoints.begin(), spacePoints.end());
-            nuNHitsTotal += spacePoints.size();
+            if (!pCluster3D)
+                continue;
+
+            nuClusters3D.push_back(pCluster3D);
+            const unsigned int nHits(pCluster3D->GetNCaloHits());
+            nuNHitsTotal += nHits;
 
-            if (spacePoints.size() < 5)
+            if (nHits < 5)
                 continue;
 
+            this->GetSpacePoints(pCluster3D, spacePoints);
             const CartesianVector dir(this->GetDirectionFromVertex(spacePoints, nuVertex));
-            nuWeightedDirTotal += dir * static_cast<float>(spacePoints.size());
-            nuNHitsUsedTotal += spacePoints.size();
+            nuWeightedDirTotal += dir * static_cast<float>(nHits);
+            nuNHitsUsedTotal += nHits;
         }
 
         if (nuNHitsUsedTotal == 0)
             return;
         const CartesianVector nuWeightedDir(nuWeightedDirTotal * (1.f / static_cast<float>(nuNHitsUsedTotal)));
 
-        CartesianPointVector pointsInSphere;
-        this->GetPointsInSphere(nuAllSpacePoints, nuVertex, 10, pointsInSphere);
-
-        CartesianVector centroid(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        unsigned int nPointsInSphere(0);
         LArPcaHelper::EigenValues eigenValues(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-        LArPcaHelper::EigenVectors eigenVectors;
-        LArPcaHelper::RunPca(pointsInSphere, centroid, eigenValues, eigenVectors);
+        this->GetEigenValuesInSphere(nuClusters3D, nuVertex, 10.f, nPointsInSphere, eigenValues);
 
         const float nuNFinalStatePfos(static_cast<float>(nuFinalStates.size()));
         const float nuVertexY(nuVertex.GetY());
         const float nuWeightedDirZ(nuWeightedDir.GetZ());
-        const float nuNSpacePointsInSphere(static_cast<float>(pointsInSphere.size()));
+        const float nuNSpacePointsInSphere(static_cast<float>(nPointsInSphere));
 
         if (eigenValues.GetX() <= std::numeric_limits<float>::epsilon())
             return;
@@ -387,17 +408,21 @@ NeutrinoIdTool<T>::SliceFeatures::SliceFeatures(const PfoList &nuPfos, const Pfo
 
         for (const ParticleFlowObject *const pPfo : crPfos)
         {
-            CartesianPointVector spacePoints;
-            this->GetSpacePoints(pPfo, spacePoints);
+            const Cluster *const pCluster3D(this->GetThreeDCluster(pPfo));
 
-            nCRHitsTotal += spacePoints.size();
+            if (!pCluster3D)
+                continue;
+
+            const unsigned int nHits(pCluster3D->GetNCaloHits());
+            nCRHitsTotal += nHits;
 
-            if (spacePoints.size() < 5)
+            if (nHits < 5)
                 continue;
 
-            if (spacePoints.size() > nCRHitsMax)
+            if (nHits > nCRHitsMax)
             {
-                nCRHitsMax = spacePoints.size();
+                nCRHitsMax = nHits;
+                this->GetSpacePoints(pCluster3D, spacePoints);
                 const CartesianVector upperDir(this->GetUpperDirection(spacePoints));
                 const CartesianVector lowerDir(this->GetLowerDirection(spacePoints));
 
@@ -503,7 +528,7 @@ const ParticleFlowObject *NeutrinoIdTool<T>::SliceFeatures::GetNeutrino(const Pf
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void NeutrinoIdTool<T>::SliceFeatures::GetSpacePoints(const ParticleFlowObject *const pPfo, CartesianPointVector &spacePoints) const
+const Cluster *NeutrinoIdTool<T>::SliceFeatures::GetThreeDCluster(const ParticleFlowObject *const pPfo) const
 {
     ClusterList clusters3D;
     LArPfoHelper::GetThreeDClusterList(pPfo, clusters3D);
@@ -511,14 +536,22 @@ void NeutrinoIdTool<T>::SliceFeatures::GetSpacePoints(const ParticleFlowObject *
     if (clusters3D.size() > 1)
         throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
 
-    if (clusters3D.empty())
-        return;
+    return (clusters3D.empty() ? nullptr : clusters3D.front());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    CaloHitList caloHits;
-    clusters3D.front()->GetOrderedCaloHitList().FillCaloHitList(caloHits);
+template <typename T>
+void NeutrinoIdTool<T>::SliceFeatures::GetSpacePoints(const Cluster *const pCluster3D, CartesianPointVector &spacePoints) const
+{
+    spacePoints.clear();
+    spacePoints.reserve(pCluster3D->GetNCaloHits());
 
-    for (const CaloHit *const pCaloHit : caloHits)
-        spacePoints.push_back(pCaloHit->GetPositionVector());
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster3D->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            spacePoints.push_back(pCaloHit->GetPositionVector());
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -577,14 +610,70 @@ CartesianVector NeutrinoIdTool<T>::SliceFeatures::GetDirection(const CartesianPo
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename T>
-void NeutrinoIdTool<T>::SliceFeatures::GetPointsInSphere(const CartesianPointVector &spacePoints, const CartesianVector &vertex,
-    const float radius, CartesianPointVector &spacePointsInSphere) const
+void NeutrinoIdTool<T>::SliceFeatures::GetEigenValuesInSphere(const ClusterVector &clusters3D, const CartesianVector &vertex, const float radius,
+    unsigned int &nPointsInSphere, LArPcaHelper::EigenValues &eigenValues) const
 {
-    for (const CartesianVector &point : spacePoints)
+    // ATTN Two passes over the hits, accumulating the same sums in the same order as LArPcaHelper::RunPca, so that results are unchanged
+    const float radiusSquared(radius * radius);
+    double meanPosition[3] = {0., 0., 0.};
+    nPointsInSphere = 0;
+
+    for (const Cluster *const pCluster3D : clusters3D)
     {
-        if ((point - vertex).GetMagnitudeSquared() <= radius * radius)
-            spacePointsInSphere.push_back(point);
+        for (const OrderedCaloHitList::value_type &layerEntry : pCluster3D->GetOrderedCaloHitList())
+        {
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+            {
+                const CartesianVector &position(pCaloHit->GetPositionVector());
+
+                if ((position - vertex).GetMagnitudeSquared() <= radiusSquared)
+                {
+                    meanPosition[0] += static_cast<double>(position.GetX());
+                    meanPosition[1] += static_cast<double>(position.GetY());
+                    meanPosition[2] += static_cast<double>(position.GetZ());
+                    ++nPointsInSphere;
+                }
+            }
+        }
     }
+
+    if (nPointsInSphere == 0)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    const double sumWeight(static_cast<double>(nPointsInSphere));
+    meanPosition[0] /= sumWeight;
+    meanPosition[1] /= sumWeight;
+    meanPosition[2] /= sumWeight;
+
+    LArPcaHelper::SecondMoments secondMoments = {0., 0., 0., 0., 0., 0.};
+
+    for (const Cluster *const pCluster3D : clusters3D)
+    {
+        for (const OrderedCaloHitList::value_type &layerEntry : pCluster3D->GetOrderedCaloHitList())
+        {
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+            {
+                const CartesianVector &position(pCaloHit->GetPositionVector());
+
+                if ((position - vertex).GetMagnitudeSquared() <= radiusSquared)
+                {
+                    const double x(position.GetX() - meanPosition[0]);
+                    const double y(position.GetY() - meanPosition[1]);
+                    const double z(position.GetZ() - meanPosition[2]);
+
+                    secondMoments[0] += x * x;
+                    secondMoments[1] += x * y;
+                    secondMoments[2] += x * z;
+                    secondMoments[3] += y * y;
+                    secondMoments[4] += y * z;
+                    secondMoments[5] += z * z;
+                }
+            }
+        }
+    }
+
+    LArPcaHelper::EigenVectors eigenVectors;
+    LArPcaHelper::RunPca(secondMoments, sumWeight, eigenValues, eigenVectors);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -619,6 +708,9 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PersistFeatures", m_persistFeatures));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceFeatureThreads", m_nSliceFeatureThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
@@ -10,6 +10,8 @@
 
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArPcaHelper.h"
+
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
@@ -95,12 +97,21 @@ private:
         const pandora::ParticleFlowObject *GetNeutrino(const pandora::PfoList &nuPfos) const;
 
         /**
-         *  @brief  Get the 3D space points in a given pfo
+         *  @brief  Get the 3D cluster in a given pfo
          *
          *  @param  pPfo input pfo
-         *  @param  spacePoints vector to hold the 3D space points associated with the input pfo
+         *
+         *  @return the address of the 3D cluster, or nullptr if the pfo has no 3D cluster
          */
-        void GetSpacePoints(const pandora::ParticleFlowObject *const pPfo, pandora::CartesianPointVector &spacePoints) const;
+        const pandora::Cluster *GetThreeDCluster(const pandora::ParticleFlowObject *const pPfo) const;
+
+        /**
+         *  @brief  Get the 3D space points in a given 3D cluster, replacing the current contents of the (reusable) output vector
+         *
+         *  @param  pCluster3D address of the 3D cluster
+         *  @param  spacePoints vector to hold the 3D space points associated with the input cluster
+         */
+        void GetSpacePoints(const pandora::Cluster *const pCluster3D, pandora::CartesianPointVector &spacePoints) const;
 
         /**
          *  @brief  Use a sliding fit to get the direction of a collection of spacepoints
@@ -142,15 +153,16 @@ private:
         pandora::CartesianVector GetLowerDirection(const pandora::CartesianPointVector &spacePoints) const;
 
         /**
-         *  @brief  Get a vector of spacepoints within a given radius of a vertex point
+         *  @brief  Run a principal component analysis of the 3D hits within a given radius of a vertex point, streaming over the hits
          *
-         *  @param  spacePoints the input spacepoints
+         *  @param  clusters3D the input 3D clusters
          *  @param  vertex the center of the sphere
          *  @param  radius the radius of the sphere
-         *  @param  spacePointsInSphere the vector to hold the spacepoint in the sphere
+         *  @param  nPointsInSphere to receive the number of hits in the sphere
+         *  @param  eigenValues to receive the eigen values
          */
-        void GetPointsInSphere(const pandora::CartesianPointVector &spacePoints, const pandora::CartesianVector &vertex, const float radius,
-            pandora::CartesianPointVector &spacePointsInSphere) const;
+        void GetEigenValuesInSphere(const pandora::ClusterVector &clusters3D, const pandora::CartesianVector &vertex, const float radius,
+            unsigned int &nPointsInSphere, LArPcaHelper::EigenValues &eigenValues) const;
 
         bool m_isAvailable;                             ///< Is the feature vector available
         LArMvaHelper::MvaFeatureVector m_featureVector; ///< The MVA feature vector
@@ -269,6 +281,8 @@ private:
 
     bool m_persistFeatures; ///< If true, the mva features will be persisted in the metadata
 
+    unsigned int m_nSliceFeatureThreads; ///< The maximum number of threads with which to calculate slice features and probabilities
+
     T m_mva;                                   ///< The mva
     std::string m_filePathEnvironmentVariable; ///< The environment variable providing a list of paths to mva files
 };
@@ -54,6 +54,8 @@ StatusCode CustomParticleCreationAlgorithm::Run()
     PfoList pfoList(pPfoList->begin(), pPfoList->end());
     VertexList vertexList(pVertexList->begin(), pVertexList->end());
 
+    this->PrepareInputPfos(pfoList);
+
     for (PfoList::const_iterator iter = pfoList.begin(), iterEnd = pfoList.end(); iter != iterEnd; ++iter)
     {
         const ParticleFlowObject *const pInputPfo = *iter;
@@ -101,6 +103,8 @@ StatusCode CustomParticleCreationAlgorithm::Run()
         }
     }
 
+    this->ClearInputPfos();
+
     if (!pTempPfoList->empty())
     {
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Pfo>(*this, m_pfoListName));
@@ -118,6 +122,18 @@ StatusCode CustomParticleCreationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void CustomParticleCreationAlgorithm::PrepareInputPfos(const PfoList &)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CustomParticleCreationAlgorithm::ClearInputPfos()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CustomParticleCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "PfoListName", m_pfoListName));
@@ -30,6 +30,19 @@ protected:
      */
     virtual void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const = 0;
 
+    /**
+     *  @brief  Prepare to create specialised Pfos from a batch of generic input Pfos, e.g. by pre-calculating expensive quantities.
+     *          Called once per event, before any calls to CreatePfo.
+     *
+     *  @param  inputPfoList the list of input Pfos
+     */
+    virtual void PrepareInputPfos(const pandora::PfoList &inputPfoList);
+
+    /**
+     *  @brief  Release anything prepared for the batch of input Pfos. Called once per event, after all calls to CreatePfo.
+     */
+    virtual void ClearInputPfos();
+
 private:
     std::string m_pfoListName;    ///< The name of the input pfo list
     std::string m_vertexListName; ///< The name of the input vertex list
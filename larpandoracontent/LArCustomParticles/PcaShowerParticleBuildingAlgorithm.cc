@@ -12,6 +12,7 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPcaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArShowerPfo.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
@@ -23,7 +24,9 @@ using namespace pandora;
 namespace lar_content
 {
 
-PcaShowerParticleBuildingAlgorithm::PcaShowerParticleBuildingAlgorithm() : m_layerFitHalfWindow(20)
+PcaShowerParticleBuildingAlgorithm::PcaShowerParticleBuildingAlgorithm() :
+    m_layerFitHalfWindow(20),
+    m_nBatchThreads(1)
 {
 }
 
@@ -33,26 +36,14 @@ void PcaShowerParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *con
 {
     try
     {
-        // In cosmic mode, build showers from all daughter pfos, otherwise require that pfo is shower-like
-        if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
-        {
-            if (!LArPfoHelper::IsShower(pInputPfo))
-                return;
-        }
-        else
-        {
-            if (LArPfoHelper::IsFinalState(pInputPfo))
-                return;
-
-            if (LArPfoHelper::IsNeutrino(pInputPfo))
-                return;
-        }
+        if (!this->IsSelected(pInputPfo))
+            return;
 
         // Need an input vertex to provide a shower propagation direction
         const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
 
         // Run the PCA analysis
-        const LArShowerPCA showerPCA(LArPfoHelper::GetPrincipalComponents(pInputPfo, pInputVertex));
+        const LArShowerPCA showerPCA(this->GetPrincipalComponents(pInputPfo, pInputVertex));
 
         // Build a new pfo
         LArShowerPfoFactory pfoFactory;
@@ -100,11 +91,86 @@ void PcaShowerParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void PcaShowerParticleBuildingAlgorithm::PrepareInputPfos(const PfoList &inputPfoList)
+{
+    m_showerPcaMap.clear();
+
+    if (m_nBatchThreads <= 1)
+        return;
+
+    PfoVector selectedPfos;
+
+    for (const ParticleFlowObject *const pInputPfo : inputPfoList)
+    {
+        if (!pInputPfo->GetVertexList().empty() && this->IsSelected(pInputPfo))
+            selectedPfos.push_back(pInputPfo);
+    }
+
+    // ATTN The principal component analysis only reads the input pfos, so can be shared between threads; status codes are recorded so
+    // that any failures are reported from CreatePfo, exactly as when calculating on demand
+    std::vector<ShowerPcaResult> showerPcaResults(selectedPfos.size());
+
+    LArThreadingHelper::ParallelFor(selectedPfos.size(), m_nBatchThreads, [&](const unsigned int index) {
+        ShowerPcaResult &showerPcaResult(showerPcaResults.at(index));
+
+        try
+        {
+            const ParticleFlowObject *const pInputPfo(selectedPfos.at(index));
+            showerPcaResult.second.reset(new LArShowerPCA(LArPfoHelper::GetPrincipalComponents(pInputPfo, LArPfoHelper::GetVertex(pInputPfo))));
+            showerPcaResult.first = STATUS_CODE_SUCCESS;
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            showerPcaResult.first = statusCodeException.GetStatusCode();
+        }
+    });
+
+    for (unsigned int index = 0; index < selectedPfos.size(); ++index)
+        m_showerPcaMap.emplace(selectedPfos.at(index), std::move(showerPcaResults.at(index)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PcaShowerParticleBuildingAlgorithm::ClearInputPfos()
+{
+    m_showerPcaMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PcaShowerParticleBuildingAlgorithm::IsSelected(const ParticleFlowObject *const pInputPfo) const
+{
+    // In cosmic mode, build showers from all daughter pfos, otherwise require that pfo is shower-like
+    if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
+        return LArPfoHelper::IsShower(pInputPfo);
+
+    return (!LArPfoHelper::IsFinalState(pInputPfo) && !LArPfoHelper::IsNeutrino(pInputPfo));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArShowerPCA PcaShowerParticleBuildingAlgorithm::GetPrincipalComponents(const ParticleFlowObject *const pInputPfo, const Vertex *const pInputVertex) const
+{
+    const ShowerPcaMap::const_iterator iter(m_showerPcaMap.find(pInputPfo));
+
+    if (m_showerPcaMap.end() == iter)
+        return LArPfoHelper::GetPrincipalComponents(pInputPfo, pInputVertex);
+
+    if (STATUS_CODE_SUCCESS != iter->second.first)
+        throw StatusCodeException(iter->second.first);
+
+    return *iter->second.second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PcaShowerParticleBuildingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "LayerFitHalfWindow", m_layerFitHalfWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NBatchThreads", m_nBatchThreads));
+
     return CustomParticleCreationAlgorithm::ReadSettings(xmlHandle);
 }
 
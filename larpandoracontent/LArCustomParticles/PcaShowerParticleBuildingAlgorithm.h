@@ -12,6 +12,9 @@
 
 #include "larpandoracontent/LArCustomParticles/CustomParticleCreationAlgorithm.h"
 
+#include <memory>
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -37,10 +40,36 @@ public:
 
 private:
     void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const;
+    void PrepareInputPfos(const pandora::PfoList &inputPfoList);
+    void ClearInputPfos();
+
+    /**
+     *  @brief  Whether a shower-like pfo should be built from a given input pfo
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *
+     *  @return boolean
+     */
+    bool IsSelected(const pandora::ParticleFlowObject *const pInputPfo) const;
+
+    /**
+     *  @brief  Get the principal components of an input pfo, using the pre-calculated principal components if available
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *  @param  pInputVertex the address of the input vertex
+     *
+     *  @return the principal components
+     */
+    LArShowerPCA GetPrincipalComponents(const pandora::ParticleFlowObject *const pInputPfo, const pandora::Vertex *const pInputVertex) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    typedef std::pair<pandora::StatusCode, std::unique_ptr<const LArShowerPCA>> ShowerPcaResult;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, ShowerPcaResult> ShowerPcaMap;
+
     unsigned int m_layerFitHalfWindow; ///<
+    unsigned int m_nBatchThreads;      ///< The number of threads used to pre-calculate input pfo principal components; if <= 1, calculate on demand
+    ShowerPcaMap m_showerPcaMap;       ///< The pre-calculated principal components (or failure status codes) for the current input pfos
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
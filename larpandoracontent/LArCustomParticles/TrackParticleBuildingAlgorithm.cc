@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTrackPfo.h"
 
@@ -22,7 +23,9 @@ using namespace pandora;
 namespace lar_content
 {
 
-TrackParticleBuildingAlgorithm::TrackParticleBuildingAlgorithm() : m_slidingFitHalfWindow(20)
+TrackParticleBuildingAlgorithm::TrackParticleBuildingAlgorithm() :
+    m_slidingFitHalfWindow(20),
+    m_nBatchThreads(1)
 {
 }
 
@@ -35,28 +38,12 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
         // Need an input vertex to provide a track propagation direction
         const Vertex *const pInputVertex = LArPfoHelper::GetVertex(pInputPfo);
 
-        // In cosmic mode, build tracks from all parent pfos, otherwise require that pfo is track-like
-        if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
-        {
-            if (!LArPfoHelper::IsTrack(pInputPfo))
-                return;
-        }
-        else
-        {
-            if (!LArPfoHelper::IsFinalState(pInputPfo))
-                return;
-
-            if (LArPfoHelper::IsNeutrino(pInputPfo))
-                return;
-        }
-
-        // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
-        const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
-        const float layerPitch(pFirstLArTPC->GetWirePitchW());
+        if (!this->IsSelected(pInputPfo))
+            return;
 
         // Calculate sliding fit trajectory
         LArTrackStateVector trackStateVector;
-        LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, pInputVertex, m_slidingFitHalfWindow, layerPitch, trackStateVector);
+        this->GetTrajectory(pInputPfo, pInputVertex, this->GetLayerPitch(), trackStateVector);
 
         if (trackStateVector.empty())
             return;
@@ -102,11 +89,102 @@ void TrackParticleBuildingAlgorithm::CreatePfo(const ParticleFlowObject *const p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrackParticleBuildingAlgorithm::PrepareInputPfos(const PfoList &inputPfoList)
+{
+    m_trajectoryMap.clear();
+
+    if (m_nBatchThreads <= 1)
+        return;
+
+    PfoVector selectedPfos;
+
+    for (const ParticleFlowObject *const pInputPfo : inputPfoList)
+    {
+        if (!pInputPfo->GetVertexList().empty() && this->IsSelected(pInputPfo))
+            selectedPfos.push_back(pInputPfo);
+    }
+
+    // ATTN Trajectory calculation only reads the input pfos, so can be shared between threads; status codes are recorded so that any
+    // failures are reported from CreatePfo, exactly as when calculating on demand
+    const float layerPitch(this->GetLayerPitch());
+    std::vector<TrajectoryResult> trajectoryResults(selectedPfos.size());
+
+    LArThreadingHelper::ParallelFor(selectedPfos.size(), m_nBatchThreads, [&](const unsigned int index) {
+        TrajectoryResult &trajectoryResult(trajectoryResults.at(index));
+
+        try
+        {
+            const ParticleFlowObject *const pInputPfo(selectedPfos.at(index));
+            LArPfoHelper::GetSlidingFitTrajectory(
+                pInputPfo, LArPfoHelper::GetVertex(pInputPfo), m_slidingFitHalfWindow, layerPitch, trajectoryResult.second);
+            trajectoryResult.first = STATUS_CODE_SUCCESS;
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            trajectoryResult.first = statusCodeException.GetStatusCode();
+            trajectoryResult.second.clear();
+        }
+    });
+
+    for (unsigned int index = 0; index < selectedPfos.size(); ++index)
+        m_trajectoryMap.emplace(selectedPfos.at(index), std::move(trajectoryResults.at(index)));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::ClearInputPfos()
+{
+    m_trajectoryMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TrackParticleBuildingAlgorithm::IsSelected(const ParticleFlowObject *const pInputPfo) const
+{
+    // In cosmic mode, build tracks from all parent pfos, otherwise require that pfo is track-like
+    if (LArPfoHelper::IsNeutrinoFinalState(pInputPfo))
+        return LArPfoHelper::IsTrack(pInputPfo);
+
+    return (LArPfoHelper::IsFinalState(pInputPfo) && !LArPfoHelper::IsNeutrino(pInputPfo));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackParticleBuildingAlgorithm::GetTrajectory(const ParticleFlowObject *const pInputPfo, const Vertex *const pInputVertex,
+    const float layerPitch, LArTrackStateVector &trackStateVector) const
+{
+    const TrajectoryMap::const_iterator iter(m_trajectoryMap.find(pInputPfo));
+
+    if (m_trajectoryMap.end() == iter)
+    {
+        LArPfoHelper::GetSlidingFitTrajectory(pInputPfo, pInputVertex, m_slidingFitHalfWindow, layerPitch, trackStateVector);
+        return;
+    }
+
+    if (STATUS_CODE_SUCCESS != iter->second.first)
+        throw StatusCodeException(iter->second.first);
+
+    trackStateVector = iter->second.second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float TrackParticleBuildingAlgorithm::GetLayerPitch() const
+{
+    // ATTN If wire w pitches vary between TPCs, exception will be raised in initialisation of lar pseudolayer plugin
+    const LArTPC *const pFirstLArTPC(this->GetPandora().GetGeometry()->GetLArTPCMap().begin()->second);
+    return pFirstLArTPC->GetWirePitchW();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackParticleBuildingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "SlidingFitHalfWindow", m_slidingFitHalfWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NBatchThreads", m_nBatchThreads));
+
     return CustomParticleCreationAlgorithm::ReadSettings(xmlHandle);
 }
 
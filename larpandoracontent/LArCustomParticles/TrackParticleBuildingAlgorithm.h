@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArCustomParticles/CustomParticleCreationAlgorithm.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -30,8 +32,42 @@ private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     void CreatePfo(const pandora::ParticleFlowObject *const pInputPfo, const pandora::ParticleFlowObject *&pOutputPfo) const;
+    void PrepareInputPfos(const pandora::PfoList &inputPfoList);
+    void ClearInputPfos();
+
+    /**
+     *  @brief  Whether a track-like pfo should be built from a given input pfo
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *
+     *  @return boolean
+     */
+    bool IsSelected(const pandora::ParticleFlowObject *const pInputPfo) const;
+
+    /**
+     *  @brief  Get the sliding fit trajectory for an input pfo, using the pre-calculated trajectory if available
+     *
+     *  @param  pInputPfo the address of the input pfo
+     *  @param  pInputVertex the address of the input vertex
+     *  @param  layerPitch the layer pitch
+     *  @param  trackStateVector to receive the trajectory
+     */
+    void GetTrajectory(const pandora::ParticleFlowObject *const pInputPfo, const pandora::Vertex *const pInputVertex, const float layerPitch,
+        LArTrackStateVector &trackStateVector) const;
+
+    /**
+     *  @brief  Get the layer pitch to use in the sliding fits
+     *
+     *  @return the layer pitch
+     */
+    float GetLayerPitch() const;
+
+    typedef std::pair<pandora::StatusCode, LArTrackStateVector> TrajectoryResult;
+    typedef std::unordered_map<const pandora::ParticleFlowObject *, TrajectoryResult> TrajectoryMap;
 
     unsigned int m_slidingFitHalfWindow; ///<
+    unsigned int m_nBatchThreads;        ///< The number of threads used to pre-calculate input pfo trajectories; if <= 1, calculate on demand
+    TrajectoryMap m_trajectoryMap;       ///< The pre-calculated trajectories (or failure status codes) for the current input pfos
 };
 
 } // namespace lar_content
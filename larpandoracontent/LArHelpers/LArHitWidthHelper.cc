@@ -132,23 +132,10 @@ LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
     ConstituentHitVector constituentHitVector;
-    for (const OrderedCaloHitList::value_type &mapEntry : orderedCaloHitList)
-    {
-        for (const CaloHit *const pCaloHit : *mapEntry.second)
-        {
-            const float hitWidth = pCaloHit->GetCellSize1() * hitWidthScalingFactor;
-            const unsigned int numberOfConstituentHits = std::ceil(hitWidth / maxConstituentHitWidth);
-            if (isUniform)
-            {
-                LArHitWidthHelper::SplitHitIntoConstituents(pCaloHit, pCluster, numberOfConstituentHits, maxConstituentHitWidth, constituentHitVector);
-            }
-            else
-            {
-                const float constituentHitWidth = hitWidth / numberOfConstituentHits;
-                LArHitWidthHelper::SplitHitIntoConstituents(pCaloHit, pCluster, numberOfConstituentHits, constituentHitWidth, constituentHitVector);
-            }
-        }
-    }
+    LArHitWidthHelper::VisitConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform,
+        [&constituentHitVector, pCluster](const CartesianVector &position, const float constituentHitWidth) {
+            constituentHitVector.push_back(ConstituentHit(position, constituentHitWidth, pCluster));
+        });
 
     return constituentHitVector;
 }
@@ -158,37 +145,19 @@ LArHitWidthHelper::ConstituentHitVector LArHitWidthHelper::GetConstituentHits(
 void LArHitWidthHelper::SplitHitIntoConstituents(const CaloHit *const pCaloHit, const Cluster *const pCluster,
     const unsigned int numberOfConstituentHits, const float constituentHitWidth, LArHitWidthHelper::ConstituentHitVector &constituentHitVector)
 {
-    const CartesianVector &hitCenter(pCaloHit->GetPositionVector());
-    const bool isOdd(numberOfConstituentHits % 2 == 1);
-    float xDistanceFromCenter(0.f);
-
-    // find constituent hit centers by moving out from the original hit center position
-    unsigned int loopIterations(std::ceil(numberOfConstituentHits / 2.0));
-    for (unsigned int i = 0; i < loopIterations; ++i)
-    {
-        if (i == 0)
-        {
-            if (isOdd)
-            {
-                constituentHitVector.push_back(ConstituentHit(hitCenter, constituentHitWidth, pCluster));
-                continue;
-            }
-            else
-            {
-                xDistanceFromCenter += constituentHitWidth / 2;
-            }
-        }
-        else
-        {
-            xDistanceFromCenter += constituentHitWidth;
-        }
+    LArHitWidthHelper::VisitHitConstituents(pCaloHit, numberOfConstituentHits, constituentHitWidth,
+        [&constituentHitVector, pCluster](const CartesianVector &position, const float hitWidth) {
+            constituentHitVector.push_back(ConstituentHit(position, hitWidth, pCluster));
+        });
+}
 
-        CartesianVector positivePosition(hitCenter + CartesianVector(xDistanceFromCenter, 0.f, 0.f)),
-            negativePosition(hitCenter - CartesianVector(xDistanceFromCenter, 0.f, 0.f));
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        constituentHitVector.push_back(ConstituentHit(positivePosition, constituentHitWidth, pCluster));
-        constituentHitVector.push_back(ConstituentHit(negativePosition, constituentHitWidth, pCluster));
-    }
+void LArHitWidthHelper::GetConstituentHitPositions(const Cluster *const pCluster, const float maxConstituentHitWidth,
+    const float hitWidthScalingFactor, const bool isUniform, CartesianPointVector &constituentHitPositionVector)
+{
+    LArHitWidthHelper::VisitConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, isUniform,
+        [&constituentHitPositionVector](const CartesianVector &position, const float) { constituentHitPositionVector.push_back(position); });
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -255,8 +224,14 @@ CartesianVector LArHitWidthHelper::GetExtremalCoordinatesHigherX(const Constitue
 void LArHitWidthHelper::GetExtremalCoordinatesX(
     const ConstituentHitVector &constituentHitVector, CartesianVector &lowerXCoordinate, CartesianVector &higherXCoordinate)
 {
-    const CartesianPointVector &constituentHitPositionVector(GetConstituentHitPositionVector(constituentHitVector));
+    LArHitWidthHelper::GetExtremalCoordinatesX(GetConstituentHitPositionVector(constituentHitVector), lowerXCoordinate, higherXCoordinate);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArHitWidthHelper::GetExtremalCoordinatesX(
+    const CartesianPointVector &constituentHitPositionVector, CartesianVector &lowerXCoordinate, CartesianVector &higherXCoordinate)
+{
     CartesianVector innerCoordinate(0.f, 0.f, 0.f), outerCoordinate(0.f, 0.f, 0.f);
     LArClusterHelper::GetExtremalCoordinates(constituentHitPositionVector, innerCoordinate, outerCoordinate);
 
@@ -8,8 +8,14 @@
 #ifndef LAR_HIT_WIDTH_HELPER_H
 #define LAR_HIT_WIDTH_HELPER_H 1
 
+#include "Objects/CaloHit.h"
 #include "Objects/Cluster.h"
 
+#include "Pandora/StatusCodes.h"
+
+#include <cmath>
+#include <limits>
+
 namespace lar_content
 {
 
@@ -235,6 +241,44 @@ public:
     static void SplitHitIntoConstituents(const pandora::CaloHit *const pCaloHit, const pandora::Cluster *const pCluster,
         const unsigned int numberOfConstituentHits, const float constituentHitWidth, ConstituentHitVector &constituentHitVector);
 
+    /**
+     *  @brief  Break up the calo hits of a cluster, as GetConstituentHits, but only obtain the constituent hit central positions
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *  @param  constituentHitPositionVector the input vector to which to add the constituent hit central positions
+     */
+    static void GetConstituentHitPositions(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+        const float hitWidthScalingFactor, const bool isUniform, pandora::CartesianPointVector &constituentHitPositionVector);
+
+    /**
+     *  @brief  Break up the calo hits of a cluster into constituent hits, passing each constituent hit in turn to a function rather than
+     *          storing the constituent hits
+     *
+     *  @param  pCluster the input cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     *  @param  isUniform whether to break up the hit into uniform constituent hits (and pad the hit) or not
+     *  @param  function the function to apply, taking the constituent hit central position and hit width as its arguments
+     */
+    template <typename FUNCTION>
+    static void VisitConstituentHits(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+        const float hitWidthScalingFactor, const bool isUniform, const FUNCTION &function);
+
+    /**
+     *  @brief  Break up the calo hit into constituent hits, passing each constituent hit central position in turn to a function
+     *
+     *  @param  pCaloHit the input calo hit
+     *  @param  numberOfConstituentHits the number of constituent hits the hit will be broken into
+     *  @param  constituentHitWidth the hit width of the constituent hits
+     *  @param  function the function to apply, taking the constituent hit central position and hit width as its arguments
+     */
+    template <typename FUNCTION>
+    static void VisitHitConstituents(const pandora::CaloHit *const pCaloHit, const unsigned int numberOfConstituentHits,
+        const float constituentHitWidth, const FUNCTION &function);
+
     /**
      *  @brief  Obtain a vector of the contituent hit central positions
      *
@@ -290,6 +334,16 @@ public:
     static void GetExtremalCoordinatesX(const ConstituentHitVector &constituentHitVector, pandora::CartesianVector &lowerXCoordinate,
         pandora::CartesianVector &higherXCoordinate);
 
+    /**
+     *  @brief  Calculate the higher and lower x extremal points of the constituent hits
+     *
+     *  @param  constituentHitPositionVector the input vector of contituent hit central positions
+     *  @param  lowerXCoordinate the lower x extremal point
+     *  @param  higherXCoordinate the higher x extremal point
+     */
+    static void GetExtremalCoordinatesX(const pandora::CartesianPointVector &constituentHitPositionVector,
+        pandora::CartesianVector &lowerXCoordinate, pandora::CartesianVector &higherXCoordinate);
+
     /**
      *  @brief  Consider the hit width to find the closest position of a calo hit to a specified line
      *
@@ -385,6 +439,70 @@ inline LArHitWidthHelper::SortByHigherXExtrema::SortByHigherXExtrema(const Clust
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename FUNCTION>
+void LArHitWidthHelper::VisitConstituentHits(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth,
+    const float hitWidthScalingFactor, const bool isUniform, const FUNCTION &function)
+{
+    if (maxConstituentHitWidth < std::numeric_limits<float>::epsilon())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_ALLOWED);
+
+    const pandora::OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+
+    if (orderedCaloHitList.empty())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    for (const pandora::OrderedCaloHitList::value_type &mapEntry : orderedCaloHitList)
+    {
+        for (const pandora::CaloHit *const pCaloHit : *mapEntry.second)
+        {
+            const float hitWidth = pCaloHit->GetCellSize1() * hitWidthScalingFactor;
+            const unsigned int numberOfConstituentHits = std::ceil(hitWidth / maxConstituentHitWidth);
+            const float constituentHitWidth = isUniform ? maxConstituentHitWidth : hitWidth / numberOfConstituentHits;
+
+            LArHitWidthHelper::VisitHitConstituents(pCaloHit, numberOfConstituentHits, constituentHitWidth, function);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename FUNCTION>
+void LArHitWidthHelper::VisitHitConstituents(
+    const pandora::CaloHit *const pCaloHit, const unsigned int numberOfConstituentHits, const float constituentHitWidth, const FUNCTION &function)
+{
+    const pandora::CartesianVector &hitCenter(pCaloHit->GetPositionVector());
+    const bool isOdd(numberOfConstituentHits % 2 == 1);
+    float xDistanceFromCenter(0.f);
+
+    // find constituent hit centers by moving out from the original hit center position
+    unsigned int loopIterations(std::ceil(numberOfConstituentHits / 2.0));
+    for (unsigned int i = 0; i < loopIterations; ++i)
+    {
+        if (i == 0)
+        {
+            if (isOdd)
+            {
+                function(hitCenter, constituentHitWidth);
+                continue;
+            }
+            else
+            {
+                xDistanceFromCenter += constituentHitWidth / 2;
+            }
+        }
+        else
+        {
+            xDistanceFromCenter += constituentHitWidth;
+        }
+
+        function(hitCenter + pandora::CartesianVector(xDistanceFromCenter, 0.f, 0.f), constituentHitWidth);
+        function(hitCenter - pandora::CartesianVector(xDistanceFromCenter, 0.f, 0.f), constituentHitWidth);
+    }
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_HIT_WIDTH_HELPER_H
@@ -17,6 +17,9 @@
 #include "Objects/CaloHit.h"
 #include "Objects/ParticleFlowObject.h"
 
+#include <set>
+#include <unordered_set>
+
 namespace lar_content
 {
 
@@ -310,32 +313,67 @@ void LArMuonLeadingHelper::AddInPostBremsstrahlungHits(const MCParticle *const p
     if (postBremsstrahlungViewHitList.empty())
         return;
 
-    bool hitsAdded(false);
+    // ATTN The absorbed hits are those connected to the leading hits by a chain of separations below maxBremsstrahlungSeparation. Absorbing,
+    // at each step, the earliest post-bremsstrahlung hit within reach of the leading hits reproduces the order of the original restarts
+    const CaloHitVector postBremsstrahlungViewHitVector(postBremsstrahlungViewHitList.begin(), postBremsstrahlungViewHitList.end());
 
-    do
-    {
-        hitsAdded = false;
+    std::unordered_multimap<const CaloHit *, unsigned int> hitToIndexMap;
+    for (unsigned int index = 0; index < postBremsstrahlungViewHitVector.size(); ++index)
+        (void)hitToIndexMap.insert(std::make_pair(postBremsstrahlungViewHitVector.at(index), index));
+
+    HitKDTree2D kdTree;
+    HitKDNode2DList hitKDNode2DList;
+
+    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(postBremsstrahlungViewHitList, hitKDNode2DList));
+    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    // ATTN Search region is padded, as the kd tree search excludes hits on its region boundaries
+    const float searchRegion1D(1.01f * maxBremsstrahlungSeparation + 0.01f);
+    std::unordered_set<const CaloHit *> leadingViewHitSet(leadingViewHitList.begin(), leadingViewHitList.end());
+    std::set<unsigned int> reachableIndices;
+
+    const auto addReachableHits = [&](const CaloHit *const pLeadingHit) {
+        KDTreeBox searchRegionHits(build_2d_kd_search_region(pLeadingHit, searchRegion1D, searchRegion1D));
 
-        for (const CaloHit *const pPostBremsstrahlungHit : postBremsstrahlungViewHitList)
+        HitKDNode2DList found;
+        kdTree.search(searchRegionHits, found);
+
+        for (const auto &hit : found)
         {
-            if (std::find(leadingViewHitList.begin(), leadingViewHitList.end(), pPostBremsstrahlungHit) != leadingViewHitList.end())
+            if (leadingViewHitSet.count(hit.data))
                 continue;
 
-            const float separationDistance(LArClusterHelper::GetClosestDistance(pPostBremsstrahlungHit->GetPositionVector(), leadingViewHitList));
-
-            if (separationDistance < maxBremsstrahlungSeparation)
+            if ((hit.data->GetPositionVector() - pLeadingHit->GetPositionVector()).GetMagnitude() < maxBremsstrahlungSeparation)
             {
-                leadingViewHitList.push_back(pPostBremsstrahlungHit);
-                hitsAdded = true;
-                break;
+                const auto range(hitToIndexMap.equal_range(hit.data));
+
+                for (auto iter = range.first; iter != range.second; ++iter)
+                    (void)reachableIndices.insert(iter->second);
             }
         }
-    } while (hitsAdded);
+    };
+
+    for (const CaloHit *const pCaloHit : leadingViewHitList)
+        addReachableHits(pCaloHit);
+
+    while (!reachableIndices.empty())
+    {
+        const CaloHit *const pPostBremsstrahlungHit(postBremsstrahlungViewHitVector.at(*reachableIndices.begin()));
+        reachableIndices.erase(reachableIndices.begin());
+
+        if (!leadingViewHitSet.insert(pPostBremsstrahlungHit).second)
+            continue;
+
+        leadingViewHitList.push_back(pPostBremsstrahlungHit);
+        addReachableHits(pPostBremsstrahlungHit);
+    }
 
     CaloHitList &leadingHitList(leadingMCToTrueHitListMap.at(pLeadingMCParticle));
+    std::unordered_set<const CaloHit *> leadingHitSet(leadingHitList.begin(), leadingHitList.end());
+
     for (const CaloHit *const pCaloHit : leadingViewHitList)
     {
-        if (std::find(leadingHitList.begin(), leadingHitList.end(), pCaloHit) == leadingHitList.end())
+        if (leadingHitSet.insert(pCaloHit).second)
             leadingHitList.push_back(pCaloHit);
     }
 }
@@ -406,20 +444,30 @@ void LArMuonLeadingHelper::GetMuonPfoContaminationContribution(
 
 float LArMuonLeadingHelper::GetClosestDistance(const Cluster *const pCluster, const CartesianPointVector &cartesianPointVector)
 {
-    float closestDistance(std::numeric_limits<float>::max());
+    HitKDTree2D kdTree;
+    LArMuonLeadingHelper::FillKDTree(pCluster, kdTree);
 
-    CaloHitList caloHitList;
-    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+    return LArMuonLeadingHelper::GetClosestDistance(kdTree, cartesianPointVector);
+}
 
-    for (const CaloHit *const pCaloHit : caloHitList)
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArMuonLeadingHelper::GetClosestDistance(HitKDTree2D &kdTree, const CartesianPointVector &cartesianPointVector)
+{
+    if (kdTree.empty())
+        return std::numeric_limits<float>::max();
+
+    float shortestDistanceSquared(std::numeric_limits<float>::max());
+
+    for (const CartesianVector &testPosition : cartesianPointVector)
     {
-        const float distance(LArMuonLeadingHelper::GetClosestDistance(pCaloHit, cartesianPointVector));
+        float separationSquared(std::numeric_limits<float>::max());
 
-        if (distance < closestDistance)
-            closestDistance = distance;
+        if (LArMuonLeadingHelper::GetClosestHit(testPosition, kdTree, nullptr, separationSquared) && (separationSquared < shortestDistanceSquared))
+            shortestDistanceSquared = separationSquared;
     }
 
-    return closestDistance;
+    return std::sqrt(shortestDistanceSquared);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -444,26 +492,41 @@ float LArMuonLeadingHelper::GetClosestDistance(const CaloHit *const pCaloHit, co
 
 StatusCode LArMuonLeadingHelper::GetClosestPosition(const CartesianVector &referencePoint, const CartesianPointVector &cartesianPointVector,
     const Cluster *const pCluster, const float maxDistanceToCluster, const float maxDistanceToReferencePoint, CartesianVector &closestPosition)
+{
+    HitKDTree2D kdTree;
+    LArMuonLeadingHelper::FillKDTree(pCluster, kdTree);
+
+    return LArMuonLeadingHelper::GetClosestPosition(
+        referencePoint, cartesianPointVector, kdTree, maxDistanceToCluster, maxDistanceToReferencePoint, closestPosition);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArMuonLeadingHelper::GetClosestPosition(const CartesianVector &referencePoint, const CartesianPointVector &cartesianPointVector,
+    HitKDTree2D &kdTree, const float maxDistanceToCluster, const float maxDistanceToReferencePoint, CartesianVector &closestPosition)
 {
     bool found(false);
     float shortestDistanceSquared(std::numeric_limits<float>::max());
 
     for (const CartesianVector &testPosition : cartesianPointVector)
     {
-        if (LArClusterHelper::GetClosestDistance(testPosition, pCluster) > maxDistanceToCluster)
+        const float separationSquared((testPosition - referencePoint).GetMagnitude());
+
+        // ATTN Positions that cannot be selected are rejected before the more expensive cluster query
+        if ((separationSquared > maxDistanceToReferencePoint) || (separationSquared >= shortestDistanceSquared))
             continue;
 
-        const float separationSquared((testPosition - referencePoint).GetMagnitude());
+        float distanceToClusterSquared(std::numeric_limits<float>::max());
+
+        if (!LArMuonLeadingHelper::GetClosestHit(testPosition, kdTree, nullptr, distanceToClusterSquared))
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-        if (separationSquared > maxDistanceToReferencePoint)
+        if (std::sqrt(distanceToClusterSquared) > maxDistanceToCluster)
             continue;
 
-        if (separationSquared < shortestDistanceSquared)
-        {
-            shortestDistanceSquared = separationSquared;
-            closestPosition = testPosition;
-            found = true;
-        }
+        shortestDistanceSquared = separationSquared;
+        closestPosition = testPosition;
+        found = true;
     }
 
     return found ? STATUS_CODE_SUCCESS : STATUS_CODE_NOT_FOUND;
@@ -473,6 +536,17 @@ StatusCode LArMuonLeadingHelper::GetClosestPosition(const CartesianVector &refer
 
 void LArMuonLeadingHelper::GetClosestPositions(const CartesianPointVector &cartesianPointVector1, const Cluster *const pCluster2,
     CartesianVector &outputPosition1, CartesianVector &outputPosition2)
+{
+    HitKDTree2D kdTree2;
+    LArMuonLeadingHelper::FillKDTree(pCluster2, kdTree2);
+
+    LArMuonLeadingHelper::GetClosestPositions(cartesianPointVector1, pCluster2, kdTree2, outputPosition1, outputPosition2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMuonLeadingHelper::GetClosestPositions(const CartesianPointVector &cartesianPointVector1, const Cluster *const pCluster2,
+    HitKDTree2D &kdTree2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
 {
     bool distanceFound(false);
     float minDistanceSquared(std::numeric_limits<float>::max());
@@ -483,21 +557,21 @@ void LArMuonLeadingHelper::GetClosestPositions(const CartesianPointVector &carte
     CaloHitList caloHitList2;
     pCluster2->GetOrderedCaloHitList().FillCaloHitList(caloHitList2);
 
+    HitToIndexMap hitToIndexMap2;
+    for (const CaloHit *const pCaloHit : caloHitList2)
+        (void)hitToIndexMap2.insert(HitToIndexMap::value_type(pCaloHit, hitToIndexMap2.size()));
+
     for (const CartesianVector &positionVector1 : cartesianPointVector1)
     {
-        for (const CaloHit *const pCaloHit : caloHitList2)
-        {
-            const CartesianVector &positionVector2(pCaloHit->GetPositionVector());
+        float distanceSquared(std::numeric_limits<float>::max());
+        const CaloHit *const pCaloHit(LArMuonLeadingHelper::GetClosestHit(positionVector1, kdTree2, &hitToIndexMap2, distanceSquared));
 
-            const float distanceSquared((positionVector1 - positionVector2).GetMagnitudeSquared());
-
-            if (distanceSquared < minDistanceSquared)
-            {
-                minDistanceSquared = distanceSquared;
-                closestPosition1 = positionVector1;
-                closestPosition2 = positionVector2;
-                distanceFound = true;
-            }
+        if (pCaloHit && (distanceSquared < minDistanceSquared))
+        {
+            minDistanceSquared = distanceSquared;
+            closestPosition1 = positionVector1;
+            closestPosition2 = pCaloHit->GetPositionVector();
+            distanceFound = true;
         }
     }
 
@@ -508,4 +582,61 @@ void LArMuonLeadingHelper::GetClosestPositions(const CartesianPointVector &carte
     outputPosition2 = closestPosition2;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArMuonLeadingHelper::FillKDTree(const Cluster *const pCluster, HitKDTree2D &kdTree)
+{
+    kdTree.clear();
+
+    CaloHitList caloHitList;
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    if (caloHitList.empty())
+        return;
+
+    HitKDNode2DList hitKDNode2DList;
+    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(caloHitList, hitKDNode2DList));
+    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CaloHit *LArMuonLeadingHelper::GetClosestHit(
+    const CartesianVector &position, HitKDTree2D &kdTree, const HitToIndexMap *const pHitToIndexMap, float &closestDistanceSquared)
+{
+    closestDistanceSquared = std::numeric_limits<float>::max();
+
+    const HitKDNode2D *pNearestHit(nullptr);
+    float nearestDistance(std::numeric_limits<float>::max());
+    const HitKDNode2D targetPosition(nullptr, position.GetX(), position.GetZ());
+    kdTree.findNearestNeighbour(targetPosition, pNearestHit, nearestDistance);
+
+    if (!pNearestHit)
+        return nullptr;
+
+    // ATTN The kd tree neglects the y coordinate and excludes points on its region boundaries, so it only bounds the search. Candidate hits
+    // from a padded region are then compared exactly as in a full scan of the cluster hits
+    const float searchRegion1D(1.01f * (position - pNearestHit->data->GetPositionVector()).GetMagnitude() + 0.01f);
+
+    HitKDNode2DList found;
+    kdTree.search(build_2d_kd_search_region(position, searchRegion1D, searchRegion1D), found);
+
+    const CaloHit *pClosestHit(nullptr);
+
+    for (const HitKDNode2D &hit : found)
+    {
+        const float distanceSquared((position - hit.data->GetPositionVector()).GetMagnitudeSquared());
+
+        if ((distanceSquared < closestDistanceSquared) ||
+            (pClosestHit && pHitToIndexMap && (distanceSquared == closestDistanceSquared) &&
+                (pHitToIndexMap->at(hit.data) < pHitToIndexMap->at(pClosestHit))))
+        {
+            closestDistanceSquared = distanceSquared;
+            pClosestHit = hit.data;
+        }
+    }
+
+    return pClosestHit;
+}
+
 } // namespace lar_content
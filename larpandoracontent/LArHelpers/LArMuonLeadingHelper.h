@@ -12,6 +12,10 @@
 
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <unordered_map>
+
 namespace lar_content
 {
 /**
@@ -36,6 +40,10 @@ public:
 
     typedef std::map<const pandora::MCParticle *, pandora::CaloHitList> LeadingMCParticleToPostBremsstrahlungHitList;
 
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
+    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+
     /**
      *  @brief  Return the MCProcess of the leading particle (tier 1) in the delta ray/michel hierarchy
      *
@@ -119,6 +127,16 @@ public:
      */
     static float GetClosestDistance(const pandora::Cluster *const pCluster, const pandora::CartesianPointVector &cartesianPointVector);
 
+    /**
+     *  @brief  Get closest distance between a cluster, held in a kd tree, and list of positions
+     *
+     *  @param  kdTree the kd tree of the cluster hits
+     *  @param  cartesianPointVector the list of input positions
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(HitKDTree2D &kdTree, const pandora::CartesianPointVector &cartesianPointVector);
+
     /**
      *  @brief  Get closest distance between a specified calo hit and list of positions
      *
@@ -145,6 +163,22 @@ public:
         const pandora::CartesianPointVector &cartesianPointVector, const pandora::Cluster *const pCluster, const float maxDistanceToCluster,
         const float maxDistanceToReferencePoint, pandora::CartesianVector &closestPosition);
 
+    /**
+     *  @brief  Get the closest position from an input list of projected positions that lies close to both a reference point and an input cluster
+     *
+     *  @param  referencePoint the input reference point
+     *  @param  cartesianPointVector the input list of projected positions
+     *  @param  kdTree the kd tree of the input cluster hits
+     *  @param  maxDistanceToCluster the maximum distance to the cluster
+     *  @param  maxDistanceToReferencePoint the maximum distance to the reference point
+     *  @param  closestPosition to receive the closest position if found
+     *
+     *  @return  whether a closest position could be found
+     */
+    static pandora::StatusCode GetClosestPosition(const pandora::CartesianVector &referencePoint,
+        const pandora::CartesianPointVector &cartesianPointVector, HitKDTree2D &kdTree, const float maxDistanceToCluster,
+        const float maxDistanceToReferencePoint, pandora::CartesianVector &closestPosition);
+
     /**
      *  @brief  Get the closest positions between a list of positions and a cluster
      *
@@ -156,7 +190,42 @@ public:
     static void GetClosestPositions(const pandora::CartesianPointVector &cartesianPointVector1, const pandora::Cluster *const pCluster2,
         pandora::CartesianVector &outputPosition1, pandora::CartesianVector &outputPosition2);
 
+    /**
+     *  @brief  Get the closest positions between a list of positions and a cluster, held in a kd tree
+     *
+     *  @param  cartesianPointVector1 the input list of positions
+     *  @param  pCluster2 the address of the input cluster
+     *  @param  kdTree2 the kd tree of the input cluster hits
+     *  @param  outputPosition1 the closest position in the list of positions
+     *  @param  outputPosition2 the closest position in the cluster
+     */
+    static void GetClosestPositions(const pandora::CartesianPointVector &cartesianPointVector1, const pandora::Cluster *const pCluster2,
+        HitKDTree2D &kdTree2, pandora::CartesianVector &outputPosition1, pandora::CartesianVector &outputPosition2);
+
+    /**
+     *  @brief  Fill a kd tree with the hits of a cluster, for use in the closest distance and position queries
+     *
+     *  @param  pCluster the address of the input cluster
+     *  @param  kdTree to receive the kd tree of the cluster hits
+     */
+    static void FillKDTree(const pandora::Cluster *const pCluster, HitKDTree2D &kdTree);
+
 private:
+    typedef std::unordered_map<const pandora::CaloHit *, unsigned int> HitToIndexMap;
+
+    /**
+     *  @brief  Get the cluster hit, held in a kd tree, closest to a specified position
+     *
+     *  @param  position the input position
+     *  @param  kdTree the kd tree of the cluster hits
+     *  @param  pHitToIndexMap address of the map from cluster hits to their ordered hit list index, to choose the earliest of equidistant hits
+     *  @param  closestDistanceSquared to receive the squared distance to the closest hit
+     *
+     *  @return the address of the closest hit, nullptr if none found
+     */
+    static const pandora::CaloHit *GetClosestHit(const pandora::CartesianVector &position, HitKDTree2D &kdTree,
+        const HitToIndexMap *const pHitToIndexMap, float &closestDistanceSquared);
+
     /**
      *  @brief  Construct the hierarchy folding map (cosmic rays folded to themselves, delta ray/michel hierarchy folded to leading particle)
      *
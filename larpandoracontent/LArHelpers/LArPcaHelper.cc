@@ -17,20 +17,9 @@ using namespace pandora;
 namespace lar_content
 {
 
-template <typename T>
-void LArPcaHelper::RunPca(const T &t, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
-{
-    WeightedPointVector weightedPointVector;
-
-    for (const auto &point : t)
-        weightedPointVector.push_back(std::make_pair(LArObjectHelper::TypeAdaptor::GetPosition(point), 1.));
-
-    return LArPcaHelper::RunPca(weightedPointVector, centroid, outputEigenValues, outputEigenVectors);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+template <typename T, typename POSITION, typename WEIGHT>
+void LArPcaHelper::RunPca(const T &t, const POSITION &getPosition, const WEIGHT &getWeight, CartesianVector &centroid,
+    EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
 {
     // The steps are:
     // 1) do a mean normalization of the input vec points
@@ -39,7 +28,7 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
     // 4) extract the eigen vectors and values
 
     // Run through the point vector and get the mean position of all points
-    if (pointVector.empty())
+    if (t.empty())
     {
         std::cout << "LArPcaHelper::RunPca - no three dimensional hits provided" << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
@@ -48,10 +37,10 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
     double meanPosition[3] = {0., 0., 0.};
     double sumWeight(0.);
 
-    for (const WeightedPoint &weightedPoint : pointVector)
+    for (const auto &element : t)
     {
-        const CartesianVector &point(weightedPoint.first);
-        const double weight(weightedPoint.second);
+        const CartesianVector &point(getPosition(element));
+        const double weight(getWeight(element));
 
         if (weight < 0.)
         {
@@ -84,10 +73,10 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
     double yizi(0.);
     double zi2(0.);
 
-    for (const WeightedPoint &weightedPoint : pointVector)
+    for (const auto &element : t)
     {
-        const CartesianVector &point(weightedPoint.first);
-        const double weight(weightedPoint.second);
+        const CartesianVector &point(getPosition(element));
+        const double weight(getWeight(element));
         const double x(static_cast<double>((point.GetX()) - meanPosition[0]));
         const double y(static_cast<double>((point.GetY()) - meanPosition[1]));
         const double z(static_cast<double>((point.GetZ()) - meanPosition[2]));
@@ -100,6 +89,43 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
         zi2 += z * z * weight;
     }
 
+    const SecondMoments secondMoments = {xi2, xiyi, xizi, yi2, yizi, zi2};
+    LArPcaHelper::RunPca(secondMoments, sumWeight, outputEigenValues, outputEigenVectors);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void LArPcaHelper::RunPca(const T &t, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+{
+    // ATTN Unit weights leave every product unchanged, so this matches the weighted implementation without building the weighted points
+    LArPcaHelper::RunPca(
+        t, [](const typename T::value_type &element) { return LArObjectHelper::TypeAdaptor::GetPosition(element); },
+        [](const typename T::value_type &) { return 1.; }, centroid, outputEigenValues, outputEigenVectors);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVector &centroid, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+{
+    LArPcaHelper::RunPca(
+        pointVector, [](const WeightedPoint &weightedPoint) -> const CartesianVector & { return weightedPoint.first; },
+        [](const WeightedPoint &weightedPoint) { return weightedPoint.second; }, centroid, outputEigenValues, outputEigenVectors);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArPcaHelper::RunPca(const SecondMoments &secondMoments, const double sumWeight, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors)
+{
+    if (std::fabs(sumWeight) < std::numeric_limits<double>::epsilon())
+    {
+        std::cout << "LArPcaHelper::RunPca - sum of weights is zero" << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    const double xi2(secondMoments[0]), xiyi(secondMoments[1]), xizi(secondMoments[2]);
+    const double yi2(secondMoments[3]), yizi(secondMoments[4]), zi2(secondMoments[5]);
+
     // Using Eigen package
     Eigen::Matrix3f sig;
 
@@ -111,7 +137,7 @@ void LArPcaHelper::RunPca(const WeightedPointVector &pointVector, CartesianVecto
 
     if (eigenMat.info() != Eigen::ComputationInfo::Success)
     {
-        std::cout << "LArPcaHelper::RunPca - decomposition failure, nThreeDHits = " << pointVector.size() << std::endl;
+        std::cout << "LArPcaHelper::RunPca - decomposition failure, sumWeight = " << sumWeight << std::endl;
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
@@ -10,6 +10,7 @@
 
 #include "Objects/CartesianVector.h"
 
+#include <array>
 #include <vector>
 
 namespace lar_content
@@ -25,6 +26,7 @@ public:
     typedef std::vector<pandora::CartesianVector> EigenVectors;
     typedef std::pair<const pandora::CartesianVector, double> WeightedPoint;
     typedef std::vector<WeightedPoint> WeightedPointVector;
+    typedef std::array<double, 6> SecondMoments; ///< Weighted sums of xx, xy, xz, yy, yz and zz displacements from the centroid
 
     /**
      *  @brief  Run principal component analysis using input calo hits (TPC_VIEW_U,V,W or TPC_3D; all treated as 3D points)
@@ -47,6 +49,31 @@ public:
      */
     static void RunPca(const WeightedPointVector &pointVector, pandora::CartesianVector &centroid, EigenValues &outputEigenValues,
         EigenVectors &outputEigenVectors);
+
+    /**
+     *  @brief  Run principal component analysis using pre-calculated second moments, allowing callers to accumulate these on the fly
+     *
+     *  @param  secondMoments the weighted sums of the products of the point displacements from their centroid
+     *  @param  sumWeight the sum of the point weights
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    static void RunPca(const SecondMoments &secondMoments, const double sumWeight, EigenValues &outputEigenValues, EigenVectors &outputEigenVectors);
+
+private:
+    /**
+     *  @brief  Run principal component analysis over a collection of points, accessing their positions and weights in place
+     *
+     *  @param  t the input collection
+     *  @param  getPosition the function returning the position of a collection element
+     *  @param  getWeight the function returning the weight of a collection element
+     *  @param  centroid to receive the centroid position
+     *  @param  outputEigenValues to receive the eigen values
+     *  @param  outputEigenVectors to receive the eigen vectors
+     */
+    template <typename T, typename POSITION, typename WEIGHT>
+    static void RunPca(const T &t, const POSITION &getPosition, const WEIGHT &getWeight, pandora::CartesianVector &centroid,
+        EigenValues &outputEigenValues, EigenVectors &outputEigenVectors);
 };
 
 } // namespace lar_content
@@ -683,6 +683,7 @@ void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVe
     const float layerPitch, LArTrackStateVector &trackStateVector, IntVector *const pIndexVector)
 {
     CartesianPointVector pointVector;
+    pointVector.reserve(pT->size());
 
     for (const auto &nextPoint : *pT)
         pointVector.push_back(LArObjectHelper::TypeAdaptor::GetPosition(nextPoint));
@@ -692,8 +693,14 @@ void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVe
 
     std::sort(pointVector.begin(), pointVector.end(), LArClusterHelper::SortCoordinatesByPosition);
 
+    // ATTN Trajectory points are filled in input order, alongside their longitudinal displacements (signed to follow the track direction),
+    // then ordered via an index permutation, so that each track state is only copied once, into the output vector
     LArTrackTrajectory trackTrajectory;
+    FloatVector sortKeys;
     IntVector indicesWithoutSpacePoints;
+    trackTrajectory.reserve(pointVector.size());
+    sortKeys.reserve(pointVector.size());
+
     if (pIndexVector)
         pIndexVector->clear();
 
@@ -734,8 +741,9 @@ void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVe
 
                 const float projection(seedDirection.GetDotProduct(position - seedPosition));
 
-                trackTrajectory.push_back(LArTrackTrajectoryPoint(projection * scaleFactor,
-                    LArTrackState(position, direction * scaleFactor, LArObjectHelper::TypeAdaptor::GetCaloHit(nextPoint)), index));
+                trackTrajectory.emplace_back(projection * scaleFactor,
+                    LArTrackState(position, direction * scaleFactor, LArObjectHelper::TypeAdaptor::GetCaloHit(nextPoint)), index);
+                sortKeys.push_back(rL * scaleFactor);
             }
             catch (const StatusCodeException &statusCodeException1)
             {
@@ -753,10 +761,17 @@ void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVe
     }
 
     // Sort trajectory points by distance along track
-    std::sort(trackTrajectory.begin(), trackTrajectory.end(), LArPfoHelper::SortByHitProjection);
+    IntVector trajectoryOrder;
+    LArPfoHelper::GetTrajectoryOrder(trackTrajectory, sortKeys, layerPitch, trajectoryOrder);
+
+    trackStateVector.reserve(trackStateVector.size() + trackTrajectory.size());
+
+    if (pIndexVector)
+        pIndexVector->reserve(trackTrajectory.size() + indicesWithoutSpacePoints.size());
 
-    for (const LArTrackTrajectoryPoint &larTrackTrajectoryPoint : trackTrajectory)
+    for (const int trajectoryIndex : trajectoryOrder)
     {
+        const LArTrackTrajectoryPoint &larTrackTrajectoryPoint(trackTrajectory.at(trajectoryIndex));
         trackStateVector.push_back(larTrackTrajectoryPoint.second);
         if (pIndexVector)
             pIndexVector->push_back(larTrackTrajectoryPoint.GetIndex());
@@ -772,6 +787,72 @@ void LArPfoHelper::SlidingFitTrajectoryImpl(const T *const pT, const CartesianVe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArPfoHelper::GetTrajectoryOrder(const LArTrackTrajectory &trackTrajectory, const FloatVector &sortKeys, const float bucketWidth, IntVector &trajectoryOrder)
+{
+    if (trackTrajectory.size() != sortKeys.size())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const int nPoints(static_cast<int>(trackTrajectory.size()));
+    trajectoryOrder.clear();
+
+    if (0 == nPoints)
+        return;
+
+    // Bucket the points by sort key, in a single linear pass, which gives the final order for any points with monotonic projections
+    const auto keyRange(std::minmax_element(sortKeys.begin(), sortKeys.end()));
+    const float keyMin(*keyRange.first), keySpan(*keyRange.second - *keyRange.first);
+    const float width(std::max(bucketWidth, keySpan / static_cast<float>(nPoints)));
+    const int nBuckets((width > std::numeric_limits<float>::epsilon()) ? std::min(nPoints, static_cast<int>(keySpan / width) + 1) : 1);
+
+    IntVector bucketIndices(nPoints, 0);
+    IntVector bucketOffsets(nBuckets + 1, 0);
+
+    for (int i = 0; i < nPoints; ++i)
+    {
+        if (nBuckets > 1)
+            bucketIndices.at(i) = std::min(nBuckets - 1, static_cast<int>((sortKeys.at(i) - keyMin) / width));
+
+        ++bucketOffsets.at(bucketIndices.at(i) + 1);
+    }
+
+    for (int bucketIndex = 0; bucketIndex < nBuckets; ++bucketIndex)
+        bucketOffsets.at(bucketIndex + 1) += bucketOffsets.at(bucketIndex);
+
+    trajectoryOrder.resize(nPoints);
+
+    for (int i = 0; i < nPoints; ++i)
+        trajectoryOrder.at(bucketOffsets.at(bucketIndices.at(i))++) = i;
+
+    // Resolve any residual disorder with an insertion sort, which is linear for nearly ordered input. Fall back to a general sort if the
+    // projections turn out not to follow the sort keys, e.g. for a trajectory that folds back on itself
+    const auto isBefore = [&trackTrajectory](const int lhs, const int rhs) {
+        return LArPfoHelper::SortByHitProjection(trackTrajectory[lhs], trackTrajectory[rhs]);
+    };
+
+    const int maxShifts(8 * nPoints);
+    int nShifts(0);
+
+    for (int i = 1; i < nPoints; ++i)
+    {
+        const int trajectoryIndex(trajectoryOrder[i]);
+        int j(i);
+
+        for (; (j > 0) && isBefore(trajectoryIndex, trajectoryOrder[j - 1]); --j)
+            trajectoryOrder[j] = trajectoryOrder[j - 1];
+
+        trajectoryOrder[j] = trajectoryIndex;
+        nShifts += (i - j);
+
+        if (nShifts > maxShifts)
+        {
+            std::sort(trajectoryOrder.begin(), trajectoryOrder.end(), isBefore);
+            return;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template void LArPfoHelper::SlidingFitTrajectoryImpl(
     const CartesianPointVector *const, const CartesianVector &, const unsigned int, const float, LArTrackStateVector &, IntVector *const);
 template void LArPfoHelper::SlidingFitTrajectoryImpl(
@@ -423,6 +423,18 @@ private:
     template <typename T>
     static void SlidingFitTrajectoryImpl(const T *const pT, const pandora::CartesianVector &vertexPosition, const unsigned int layerWindow,
         const float layerPitch, LArTrackStateVector &trackStateVector, pandora::IntVector *const pIndexVector = nullptr);
+
+    /**
+     *  @brief  Get the order of trajectory points by distance along track (as defined by SortByHitProjection), using approximate sort keys
+     *          that increase along the track to avoid a general sort
+     *
+     *  @param  trackTrajectory the trajectory points
+     *  @param  sortKeys the sort keys, one per trajectory point
+     *  @param  bucketWidth the sort key bucket width
+     *  @param  trajectoryOrder to receive the indices of the trajectory points, in order
+     */
+    static void GetTrajectoryOrder(const LArTrackTrajectory &trackTrajectory, const pandora::FloatVector &sortKeys, const float bucketWidth,
+        pandora::IntVector &trajectoryOrder);
 };
 
 } // namespace lar_content
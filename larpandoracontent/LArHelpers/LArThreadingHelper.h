@@ -0,0 +1,90 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArThreadingHelper.h
+ *
+ *  @brief  Header file for the threading helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_THREADING_HELPER_H
+#define LAR_THREADING_HELPER_H 1
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArThreadingHelper class
+ */
+class LArThreadingHelper
+{
+public:
+    /**
+     *  @brief  Apply a function to each index in the range [0, nItems), sharing the indices between worker threads. Each index is
+     *          processed exactly once. The function may only read shared state and must only write to state owned by its index, so
+     *          no Pandora content api calls may be made. The first exception raised by any worker is rethrown on the calling thread,
+     *          once all workers have finished.
+     *
+     *  @param  nItems the number of items
+     *  @param  nThreads the maximum number of threads to use, including the calling thread; the items are processed serially if <= 1
+     *  @param  function the function to apply, taking the item index as its argument
+     */
+    template <typename FUNCTION>
+    static void ParallelFor(const unsigned int nItems, const unsigned int nThreads, const FUNCTION &function);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename FUNCTION>
+void LArThreadingHelper::ParallelFor(const unsigned int nItems, const unsigned int nThreads, const FUNCTION &function)
+{
+    const unsigned int nWorkers(std::min(nItems, nThreads));
+
+    if (nWorkers <= 1)
+    {
+        for (unsigned int index = 0; index < nItems; ++index)
+            function(index);
+
+        return;
+    }
+
+    std::atomic<unsigned int> nextIndex(0);
+    std::vector<std::exception_ptr> exceptions(nWorkers);
+
+    auto worker = [&](const unsigned int workerIndex) {
+        try
+        {
+            for (unsigned int index = nextIndex++; index < nItems; index = nextIndex++)
+                function(index);
+        }
+        catch (...)
+        {
+            exceptions.at(workerIndex) = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nWorkers - 1);
+
+    for (unsigned int workerIndex = 1; workerIndex < nWorkers; ++workerIndex)
+        threads.emplace_back(worker, workerIndex);
+
+    worker(0);
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (const std::exception_ptr &exception : exceptions)
+    {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_THREADING_HELPER_H
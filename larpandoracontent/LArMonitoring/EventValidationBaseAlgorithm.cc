@@ -75,7 +75,7 @@ StatusCode EventValidationBaseAlgorithm::Run()
     if (m_printMatchingToScreen)
         this->PrintInterpretedMatches(validationInfo);
 
-    if (m_writeToTree)
+    if (m_treeWriter.IsWriting())
         this->WriteInterpretedMatches(validationInfo);
 
     return STATUS_CODE_SUCCESS;
@@ -257,15 +257,21 @@ StatusCode EventValidationBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MatchingMinPurity", m_matchingMinPurity));
 
-    if (m_writeToTree)
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_treeWriter.ReadColumnarSettings(xmlHandle));
+
+    if (m_writeToTree || m_treeWriter.IsColumnarOutputRequested())
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputTree", m_treeName));
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputFile", m_fileName));
+
+        if (m_writeToTree)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputFile", m_fileName));
 
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FileIdentifier", m_fileIdentifier));
     }
 
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_treeWriter.Open(this, m_writeToTree, m_treeName));
+
     return STATUS_CODE_SUCCESS;
 }
 
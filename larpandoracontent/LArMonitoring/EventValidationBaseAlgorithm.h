@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
+#include "larpandoracontent/LArMonitoring/ValidationTreeWriter.h"
+
 #ifdef MONITORING
 #include "PandoraMonitoringApi.h"
 #endif
@@ -187,6 +189,20 @@ protected:
      */
     bool IsGoodMatch(const pandora::CaloHitList &trueHits, const pandora::CaloHitList &recoHits, const pandora::CaloHitList &sharedHits) const;
 
+    /**
+     *  @brief  Set a variable in the output tree, forwarding it to the monitoring tree and/or the columnar file as configured
+     *
+     *  @param  variableName the variable name
+     *  @param  t the variable value, or the address of the variable for vector variables
+     */
+    template <typename T>
+    void SetTreeVariable(const std::string &variableName, const T &t) const;
+
+    /**
+     *  @brief  Fill the output tree, forwarding to the monitoring tree and/or the columnar file as configured
+     */
+    void FillTree() const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     LArMCParticleHelper::PrimaryParameters m_primaryParameters; ///< The mc particle primary selection parameters
@@ -233,6 +249,8 @@ private:
     float m_matchingMinPurity;            ///< The minimum particle purity to declare a match
 
     std::string m_fileName; ///< Name of output file
+
+    ValidationTreeWriter m_treeWriter; ///< The writer of the output tree, to the monitoring tree and/or a columnar file
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -317,6 +335,21 @@ inline void EventValidationBaseAlgorithm::PrintAllMatches(const ValidationInfo &
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+inline void EventValidationBaseAlgorithm::SetTreeVariable(const std::string &variableName, const T &t) const
+{
+    m_treeWriter.SetVariable(variableName, t);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void EventValidationBaseAlgorithm::FillTree() const
+{
+    m_treeWriter.Fill();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline void EventValidationBaseAlgorithm::PrintInterpretedMatches(const ValidationInfo &validationInfo) const
 {
     return this->ProcessOutput(validationInfo, true, true, false);
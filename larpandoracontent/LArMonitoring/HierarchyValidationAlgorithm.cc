@@ -77,7 +77,7 @@ StatusCode HierarchyValidationAlgorithm::Run()
 
 void HierarchyValidationAlgorithm::EventValidation(const LArHierarchyHelper::MatchInfo &matchInfo) const
 {
-    if (m_writeTree)
+    if (m_treeWriter.IsWriting())
     {
         const LArHierarchyHelper::MCMatchesVector &matches{matchInfo.GetMatches()};
         MCParticleSet primaryMCSet;
@@ -161,30 +161,30 @@ void HierarchyValidationAlgorithm::EventValidation(const LArHierarchyHelper::Mat
         const float vtxDz{recoVertex.GetZ() - trueVertex.GetZ()};
         const float vtxDr{std::sqrt(vtxDx * vtxDx + vtxDy * vtxDy + vtxDz * vtxDz)};
 
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "event", m_event));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "interactionType", interactionType));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nGoodMatches", nGoodMatches));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nPoorMatches", nPoorMatches));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nUnmatched", nUnmatched));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nNodes", nNodes));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nGoodTier1Matches", nGoodTier1Matches));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nTier1Nodes", nTier1Nodes));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nGoodTrackMatches", nGoodTrackMatches));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nGoodShowerMatches", nGoodShowerMatches));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nTrackNodes", nTrackNodes));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nShowerNodes", nShowerNodes));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nGoodTier1TrackMatches", nGoodTier1TrackMatches));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nTier1TrackNodes", nTier1TrackNodes));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nGoodTier1ShowerMatches", nGoodTier1ShowerMatches));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nTier1ShowerNodes", nTier1ShowerNodes));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "hasLeadingMuon", hasLeadingMuon));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "hasLeadingElectron", hasLeadingElectron));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "isLeadingLeptonCorrect", isLeadingLeptonCorrect));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDx", vtxDx));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDy", vtxDy));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDz", vtxDz));
-        PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDr", vtxDr));
-        PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treename.c_str()));
+        m_treeWriter.SetVariable("event", m_event);
+        m_treeWriter.SetVariable("interactionType", interactionType);
+        m_treeWriter.SetVariable("nGoodMatches", nGoodMatches);
+        m_treeWriter.SetVariable("nPoorMatches", nPoorMatches);
+        m_treeWriter.SetVariable("nUnmatched", nUnmatched);
+        m_treeWriter.SetVariable("nNodes", nNodes);
+        m_treeWriter.SetVariable("nGoodTier1Matches", nGoodTier1Matches);
+        m_treeWriter.SetVariable("nTier1Nodes", nTier1Nodes);
+        m_treeWriter.SetVariable("nGoodTrackMatches", nGoodTrackMatches);
+        m_treeWriter.SetVariable("nGoodShowerMatches", nGoodShowerMatches);
+        m_treeWriter.SetVariable("nTrackNodes", nTrackNodes);
+        m_treeWriter.SetVariable("nShowerNodes", nShowerNodes);
+        m_treeWriter.SetVariable("nGoodTier1TrackMatches", nGoodTier1TrackMatches);
+        m_treeWriter.SetVariable("nTier1TrackNodes", nTier1TrackNodes);
+        m_treeWriter.SetVariable("nGoodTier1ShowerMatches", nGoodTier1ShowerMatches);
+        m_treeWriter.SetVariable("nTier1ShowerNodes", nTier1ShowerNodes);
+        m_treeWriter.SetVariable("hasLeadingMuon", hasLeadingMuon);
+        m_treeWriter.SetVariable("hasLeadingElectron", hasLeadingElectron);
+        m_treeWriter.SetVariable("isLeadingLeptonCorrect", isLeadingLeptonCorrect);
+        m_treeWriter.SetVariable("vtxDx", vtxDx);
+        m_treeWriter.SetVariable("vtxDy", vtxDy);
+        m_treeWriter.SetVariable("vtxDz", vtxDz);
+        m_treeWriter.SetVariable("vtxDr", vtxDr);
+        m_treeWriter.Fill();
     }
 }
 
@@ -192,7 +192,7 @@ void HierarchyValidationAlgorithm::EventValidation(const LArHierarchyHelper::Mat
 
 void HierarchyValidationAlgorithm::MCValidation(const LArHierarchyHelper::MatchInfo &matchInfo) const
 {
-    if (m_writeTree)
+    if (m_treeWriter.IsWriting())
     {
         for (const LArHierarchyHelper::MCMatches &match : matchInfo.GetMatches())
             this->Fill(match, matchInfo);
@@ -261,41 +261,41 @@ void HierarchyValidationAlgorithm::Fill(const LArHierarchyHelper::MCMatches &mat
 
     // Would like to add information on hierarchy matching. Needs some thought, it's extremely complicated
 
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "event", m_event));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "mcId", mcId));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "mcPDG", pdg));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "mcTier", tier));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "mcNHits", mcHits));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "isNuInteration", isNeutrinoInt));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "isCosmicRay", isCosmicRay));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "isTestBeam", isTestBeam));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "isLeadingLepton", isLeadingLepton));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "isMichel", isMichel));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nMatches", nMatches));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "recoIdVector", &recoIdVector));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nRecoHitsVector", &nRecoHitsVector));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "nSharedHitsVector", &nSharedHitsVector));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityVector", &purityVector));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessVector", &completenessVector));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityAdcVector", &purityAdcVector));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessAdcVector", &completenessAdcVector));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityVectorU", &purityVectorU));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityVectorV", &purityVectorV));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityVectorW", &purityVectorW));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessVectorU", &completenessVectorU));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessVectorV", &completenessVectorV));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessVectorW", &completenessVectorW));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityAdcVectorU", &purityAdcVectorU));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityAdcVectorV", &purityAdcVectorV));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "purityAdcVectorW", &purityAdcVectorW));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessAdcVectorU", &completenessAdcVectorU));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessAdcVectorV", &completenessAdcVectorV));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "completenessAdcVectorW", &completenessAdcVectorW));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDx", vtxDx));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDy", vtxDy));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDz", vtxDz));
-    PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treename.c_str(), "vtxDr", vtxDr));
-    PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treename.c_str()));
+    m_treeWriter.SetVariable("event", m_event);
+    m_treeWriter.SetVariable("mcId", mcId);
+    m_treeWriter.SetVariable("mcPDG", pdg);
+    m_treeWriter.SetVariable("mcTier", tier);
+    m_treeWriter.SetVariable("mcNHits", mcHits);
+    m_treeWriter.SetVariable("isNuInteration", isNeutrinoInt);
+    m_treeWriter.SetVariable("isCosmicRay", isCosmicRay);
+    m_treeWriter.SetVariable("isTestBeam", isTestBeam);
+    m_treeWriter.SetVariable("isLeadingLepton", isLeadingLepton);
+    m_treeWriter.SetVariable("isMichel", isMichel);
+    m_treeWriter.SetVariable("nMatches", nMatches);
+    m_treeWriter.SetVariable("recoIdVector", &recoIdVector);
+    m_treeWriter.SetVariable("nRecoHitsVector", &nRecoHitsVector);
+    m_treeWriter.SetVariable("nSharedHitsVector", &nSharedHitsVector);
+    m_treeWriter.SetVariable("purityVector", &purityVector);
+    m_treeWriter.SetVariable("completenessVector", &completenessVector);
+    m_treeWriter.SetVariable("purityAdcVector", &purityAdcVector);
+    m_treeWriter.SetVariable("completenessAdcVector", &completenessAdcVector);
+    m_treeWriter.SetVariable("purityVectorU", &purityVectorU);
+    m_treeWriter.SetVariable("purityVectorV", &purityVectorV);
+    m_treeWriter.SetVariable("purityVectorW", &purityVectorW);
+    m_treeWriter.SetVariable("completenessVectorU", &completenessVectorU);
+    m_treeWriter.SetVariable("completenessVectorV", &completenessVectorV);
+    m_treeWriter.SetVariable("completenessVectorW", &completenessVectorW);
+    m_treeWriter.SetVariable("purityAdcVectorU", &purityAdcVectorU);
+    m_treeWriter.SetVariable("purityAdcVectorV", &purityAdcVectorV);
+    m_treeWriter.SetVariable("purityAdcVectorW", &purityAdcVectorW);
+    m_treeWriter.SetVariable("completenessAdcVectorU", &completenessAdcVectorU);
+    m_treeWriter.SetVariable("completenessAdcVectorV", &completenessAdcVectorV);
+    m_treeWriter.SetVariable("completenessAdcVectorW", &completenessAdcVectorW);
+    m_treeWriter.SetVariable("vtxDx", vtxDx);
+    m_treeWriter.SetVariable("vtxDy", vtxDy);
+    m_treeWriter.SetVariable("vtxDz", vtxDz);
+    m_treeWriter.SetVariable("vtxDr", vtxDr);
+    m_treeWriter.Fill();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -313,9 +313,11 @@ StatusCode HierarchyValidationAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ValidateMC", m_validateMC));
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "WriteTree", m_writeTree));
-    if (m_writeTree)
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_treeWriter.ReadColumnarSettings(xmlHandle));
+    if (m_writeTree || m_treeWriter.IsColumnarOutputRequested())
     {
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "FileName", m_filename));
+        if (m_writeTree)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "FileName", m_filename));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TreeName", m_treename));
         if (!(m_validateEvent || m_validateMC))
         {
@@ -329,6 +331,8 @@ StatusCode HierarchyValidationAlgorithm::ReadSettings(const TiXmlHandle xmlHandl
         }
     }
 
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, m_treeWriter.Open(this, m_writeTree, m_treename));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FoldToPrimaries", m_foldToPrimaries));
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FoldDynamic", m_foldDynamic));
     PANDORA_RETURN_RESULT_IF_AND_IF(
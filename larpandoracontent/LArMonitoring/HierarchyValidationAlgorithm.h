@@ -13,6 +13,8 @@
 #include "larpandoracontent/LArHelpers/LArHierarchyHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
+#include "larpandoracontent/LArMonitoring/ValidationTreeWriter.h"
+
 namespace lar_content
 {
 
@@ -66,6 +68,8 @@ private:
     bool m_foldToLeadingShowers;   ///< Whether or not to fold the hierarchy back to leading shower particles
     bool m_validateEvent;          ///< Whether to validate at the level of an event
     bool m_validateMC;             ///< Whether to validate at the level of MC nodes
+
+    ValidationTreeWriter m_treeWriter; ///< The writer of the output tree, to the ROOT tree and/or a columnar file
 };
 
 } // namespace lar_content
@@ -271,12 +271,10 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
         // Cosmic ray parameters
         int nReconstructableChildCRLs(0), nCorrectChildCRLs(0);
 
-#ifdef MONITORING
         int ID_CR(0);
         float mcE_CR(0.f), mcPX_CR(0.f), mcPY_CR(0.f), mcPZ_CR(0.f);
         int nMCHitsTotal_CR(0), nMCHitsU_CR(0), nMCHitsV_CR(0), nMCHitsW_CR(0);
         float mcVertexX_CR(0.f), mcVertexY_CR(0.f), mcVertexZ_CR(0.f), mcEndX_CR(0.f), mcEndY_CR(0.f), mcEndZ_CR(0.f);
-#endif
 
         // Leading particle parameters
         FloatVector mcE_CRL, mcPX_CRL, mcPY_CRL, mcPZ_CRL;
@@ -356,7 +354,6 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
         }
         ///////////////////////////////
 
-#ifdef MONITORING
         ID_CR = muonCount;
         mcE_CR = pCosmicRay->GetEnergy();
         mcPX_CR = pCosmicRay->GetMomentum().GetX();
@@ -372,7 +369,6 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
         nMCHitsU_CR = LArMonitoringHelper::CountHitsByType(TPC_VIEW_U, cosmicRayHitList);
         nMCHitsV_CR = LArMonitoringHelper::CountHitsByType(TPC_VIEW_V, cosmicRayHitList);
         nMCHitsW_CR = LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, cosmicRayHitList);
-#endif
         nReconstructableChildCRLs = childLeadingParticles.size();
 
         stringStream << "\033[34m"
@@ -672,102 +668,78 @@ void MuonLeadingEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", m_eventNumber - 1));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "ID_CR", ID_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcE_CR", mcE_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPX_CR", mcPX_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPY_CR", mcPY_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPZ_CR", mcPZ_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsTotal_CR", nMCHitsTotal_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsU_CR", nMCHitsU_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsV_CR", nMCHitsV_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsW_CR", nMCHitsW_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexX_CR", mcVertexX_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexY_CR", mcVertexY_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexZ_CR", mcVertexZ_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndX_CR", mcEndX_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndY_CR", mcEndY_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndZ_CR", mcEndZ_CR));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nReconstructableChildCRLs", nReconstructableChildCRLs));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nCorrectChildCRLs", nCorrectChildCRLs));
-
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "ID_CRL", &ID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcE_CRL", &mcE_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPX_CRL", &mcPX_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPY_CRL", &mcPY_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPZ_CRL", &mcPZ_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsTotal_CRL", &nMCHitsTotal_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsU_CRL", &nMCHitsU_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsV_CRL", &nMCHitsV_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nMCHitsW_CRL", &nMCHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexX_CRL", &mcVertexX_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexY_CRL", &mcVertexY_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcVertexZ_CRL", &mcVertexZ_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndX_CRL", &mcEndX_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndY_CRL", &mcEndY_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcEndZ_CRL", &mcEndZ_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nAboveThresholdMatches_CRL", &nAboveThresholdMatches_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrect_CRL", &isCorrect_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectParentLink_CRL", &isCorrectParentLink_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsTotal_CRL", &bestMatchNHitsTotal_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsU_CRL", &bestMatchNHitsU_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsV_CRL", &bestMatchNHitsV_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNHitsW_CRL", &bestMatchNHitsW_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsTotal_CRL", &bestMatchNSharedHitsTotal_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsU_CRL", &bestMatchNSharedHitsU_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsV_CRL", &bestMatchNSharedHitsV_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNSharedHitsW_CRL", &bestMatchNSharedHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsTotal_CRL", &bestMatchNParentTrackHitsTotal_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsU_CRL", &bestMatchNParentTrackHitsU_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsV_CRL", &bestMatchNParentTrackHitsV_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNParentTrackHitsW_CRL", &bestMatchNParentTrackHitsW_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsTotal_CRL", &bestMatchNOtherTrackHitsTotal_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsU_CRL", &bestMatchNOtherTrackHitsU_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsV_CRL", &bestMatchNOtherTrackHitsV_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherTrackHitsW_CRL", &bestMatchNOtherTrackHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsTotal_CRL", &bestMatchNOtherShowerHitsTotal_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsU_CRL", &bestMatchNOtherShowerHitsU_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsV_CRL", &bestMatchNOtherShowerHitsV_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchNOtherShowerHitsW_CRL", &bestMatchNOtherShowerHitsW_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "totalCRLHitsInBestMatchParentCR_CRL", &totalCRLHitsInBestMatchParentCR_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "uCRLHitsInBestMatchParentCR_CRL", &uCRLHitsInBestMatchParentCR_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "vCRLHitsInBestMatchParentCR_CRL", &vCRLHitsInBestMatchParentCR_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "wCRLHitsInBestMatchParentCR_CRL", &wCRLHitsInBestMatchParentCR_CRL));
-
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchOtherShowerHitsID_CRL", &bestMatchOtherShowerHitsID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchOtherShowerHitsDistance_CRL", &bestMatchOtherShowerHitsDistance_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchOtherTrackHitsID_CRL", &bestMatchOtherTrackHitsID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchOtherTrackHitsDistance_CRL", &bestMatchOtherTrackHitsDistance_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchParentTrackHitsID_CRL", &bestMatchParentTrackHitsID_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(
-                this->GetPandora(), m_treeName.c_str(), "bestMatchParentTrackHitsDistance_CRL", &bestMatchParentTrackHitsDistance_CRL));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchCRLHitsInCRID_CRL", &bestMatchCRLHitsInCRID_CRL));
-            PANDORA_MONITORING_API(
-                SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchCRLHitsInCRDistance_CRL", &bestMatchCRLHitsInCRDistance_CRL));
-
-            PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+            this->SetTreeVariable("eventNumber", m_eventNumber - 1);
+            this->SetTreeVariable("ID_CR", ID_CR);
+            this->SetTreeVariable("mcE_CR", mcE_CR);
+            this->SetTreeVariable("mcPX_CR", mcPX_CR);
+            this->SetTreeVariable("mcPY_CR", mcPY_CR);
+            this->SetTreeVariable("mcPZ_CR", mcPZ_CR);
+            this->SetTreeVariable("nMCHitsTotal_CR", nMCHitsTotal_CR);
+            this->SetTreeVariable("nMCHitsU_CR", nMCHitsU_CR);
+            this->SetTreeVariable("nMCHitsV_CR", nMCHitsV_CR);
+            this->SetTreeVariable("nMCHitsW_CR", nMCHitsW_CR);
+            this->SetTreeVariable("mcVertexX_CR", mcVertexX_CR);
+            this->SetTreeVariable("mcVertexY_CR", mcVertexY_CR);
+            this->SetTreeVariable("mcVertexZ_CR", mcVertexZ_CR);
+            this->SetTreeVariable("mcEndX_CR", mcEndX_CR);
+            this->SetTreeVariable("mcEndY_CR", mcEndY_CR);
+            this->SetTreeVariable("mcEndZ_CR", mcEndZ_CR);
+            this->SetTreeVariable("nReconstructableChildCRLs", nReconstructableChildCRLs);
+            this->SetTreeVariable("nCorrectChildCRLs", nCorrectChildCRLs);
+
+            this->SetTreeVariable("ID_CRL", &ID_CRL);
+            this->SetTreeVariable("mcE_CRL", &mcE_CRL);
+            this->SetTreeVariable("mcPX_CRL", &mcPX_CRL);
+            this->SetTreeVariable("mcPY_CRL", &mcPY_CRL);
+            this->SetTreeVariable("mcPZ_CRL", &mcPZ_CRL);
+            this->SetTreeVariable("nMCHitsTotal_CRL", &nMCHitsTotal_CRL);
+            this->SetTreeVariable("nMCHitsU_CRL", &nMCHitsU_CRL);
+            this->SetTreeVariable("nMCHitsV_CRL", &nMCHitsV_CRL);
+            this->SetTreeVariable("nMCHitsW_CRL", &nMCHitsW_CRL);
+            this->SetTreeVariable("mcVertexX_CRL", &mcVertexX_CRL);
+            this->SetTreeVariable("mcVertexY_CRL", &mcVertexY_CRL);
+            this->SetTreeVariable("mcVertexZ_CRL", &mcVertexZ_CRL);
+            this->SetTreeVariable("mcEndX_CRL", &mcEndX_CRL);
+            this->SetTreeVariable("mcEndY_CRL", &mcEndY_CRL);
+            this->SetTreeVariable("mcEndZ_CRL", &mcEndZ_CRL);
+            this->SetTreeVariable("nAboveThresholdMatches_CRL", &nAboveThresholdMatches_CRL);
+            this->SetTreeVariable("isCorrect_CRL", &isCorrect_CRL);
+            this->SetTreeVariable("isCorrectParentLink_CRL", &isCorrectParentLink_CRL);
+            this->SetTreeVariable("bestMatchNHitsTotal_CRL", &bestMatchNHitsTotal_CRL);
+            this->SetTreeVariable("bestMatchNHitsU_CRL", &bestMatchNHitsU_CRL);
+            this->SetTreeVariable("bestMatchNHitsV_CRL", &bestMatchNHitsV_CRL);
+            this->SetTreeVariable("bestMatchNHitsW_CRL", &bestMatchNHitsW_CRL);
+            this->SetTreeVariable("bestMatchNSharedHitsTotal_CRL", &bestMatchNSharedHitsTotal_CRL);
+            this->SetTreeVariable("bestMatchNSharedHitsU_CRL", &bestMatchNSharedHitsU_CRL);
+            this->SetTreeVariable("bestMatchNSharedHitsV_CRL", &bestMatchNSharedHitsV_CRL);
+            this->SetTreeVariable("bestMatchNSharedHitsW_CRL", &bestMatchNSharedHitsW_CRL);
+            this->SetTreeVariable("bestMatchNParentTrackHitsTotal_CRL", &bestMatchNParentTrackHitsTotal_CRL);
+            this->SetTreeVariable("bestMatchNParentTrackHitsU_CRL", &bestMatchNParentTrackHitsU_CRL);
+            this->SetTreeVariable("bestMatchNParentTrackHitsV_CRL", &bestMatchNParentTrackHitsV_CRL);
+            this->SetTreeVariable("bestMatchNParentTrackHitsW_CRL", &bestMatchNParentTrackHitsW_CRL);
+            this->SetTreeVariable("bestMatchNOtherTrackHitsTotal_CRL", &bestMatchNOtherTrackHitsTotal_CRL);
+            this->SetTreeVariable("bestMatchNOtherTrackHitsU_CRL", &bestMatchNOtherTrackHitsU_CRL);
+            this->SetTreeVariable("bestMatchNOtherTrackHitsV_CRL", &bestMatchNOtherTrackHitsV_CRL);
+            this->SetTreeVariable("bestMatchNOtherTrackHitsW_CRL", &bestMatchNOtherTrackHitsW_CRL);
+            this->SetTreeVariable("bestMatchNOtherShowerHitsTotal_CRL", &bestMatchNOtherShowerHitsTotal_CRL);
+            this->SetTreeVariable("bestMatchNOtherShowerHitsU_CRL", &bestMatchNOtherShowerHitsU_CRL);
+            this->SetTreeVariable("bestMatchNOtherShowerHitsV_CRL", &bestMatchNOtherShowerHitsV_CRL);
+            this->SetTreeVariable("bestMatchNOtherShowerHitsW_CRL", &bestMatchNOtherShowerHitsW_CRL);
+            this->SetTreeVariable("totalCRLHitsInBestMatchParentCR_CRL", &totalCRLHitsInBestMatchParentCR_CRL);
+            this->SetTreeVariable("uCRLHitsInBestMatchParentCR_CRL", &uCRLHitsInBestMatchParentCR_CRL);
+            this->SetTreeVariable("vCRLHitsInBestMatchParentCR_CRL", &vCRLHitsInBestMatchParentCR_CRL);
+            this->SetTreeVariable("wCRLHitsInBestMatchParentCR_CRL", &wCRLHitsInBestMatchParentCR_CRL);
+
+            this->SetTreeVariable("bestMatchOtherShowerHitsID_CRL", &bestMatchOtherShowerHitsID_CRL);
+            this->SetTreeVariable("bestMatchOtherShowerHitsDistance_CRL", &bestMatchOtherShowerHitsDistance_CRL);
+            this->SetTreeVariable("bestMatchOtherTrackHitsID_CRL", &bestMatchOtherTrackHitsID_CRL);
+            this->SetTreeVariable("bestMatchOtherTrackHitsDistance_CRL", &bestMatchOtherTrackHitsDistance_CRL);
+            this->SetTreeVariable("bestMatchParentTrackHitsID_CRL", &bestMatchParentTrackHitsID_CRL);
+            this->SetTreeVariable("bestMatchParentTrackHitsDistance_CRL", &bestMatchParentTrackHitsDistance_CRL);
+            this->SetTreeVariable("bestMatchCRLHitsInCRID_CRL", &bestMatchCRLHitsInCRID_CRL);
+            this->SetTreeVariable("bestMatchCRLHitsInCRDistance_CRL", &bestMatchCRLHitsInCRDistance_CRL);
+
+            this->FillTree();
         }
 
         stringStream << "------------------------------------------------------------------------------------------------" << std::endl;
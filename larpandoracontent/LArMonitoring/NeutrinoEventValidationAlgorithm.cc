@@ -175,10 +175,8 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
         const int mcNuanceCode(LArMCParticleHelper::GetNuanceCode(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)));
         const int isBeamNeutrinoFinalState(LArMCParticleHelper::IsBeamNeutrinoFinalState(pMCPrimary));
         const int isCosmicRay(LArMCParticleHelper::IsCosmicRay(pMCPrimary));
-#ifdef MONITORING
         const CartesianVector &targetVertex(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)->GetVertex());
         const float targetVertexX(targetVertex.GetX()), targetVertexY(targetVertex.GetY()), targetVertexZ(targetVertex.GetZ());
-#endif
 
         targetSS << (!isTargetPrimary ? "(Non target) " : "") << "PrimaryId " << mcPrimaryIndex << ", Nu " << isBeamNeutrinoFinalState
                  << ", CR " << isCosmicRay << ", MCPDG " << pMCPrimary->GetParticleId() << ", Energy " << pMCPrimary->GetEnergy()
@@ -205,10 +203,8 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
         nMCHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, mcPrimaryHitList));
 
         int matchIndex(0), nPrimaryMatches(0), nPrimaryNuMatches(0), nPrimaryCRMatches(0), nPrimaryGoodNuMatches(0), nPrimaryNuSplits(0);
-#ifdef MONITORING
         float recoVertexX(std::numeric_limits<float>::max()), recoVertexY(std::numeric_limits<float>::max()),
             recoVertexZ(std::numeric_limits<float>::max());
-#endif
         for (const LArMCParticleHelper::PfoCaloHitListPair &pfoToSharedHits : mcToPfoHitSharingMap.at(pMCPrimary))
         {
             const CaloHitList &sharedHitList(pfoToSharedHits.second);
@@ -234,7 +230,6 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
                 bestMatchPfoNSharedHitsU.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_U, sharedHitList));
                 bestMatchPfoNSharedHitsV.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_V, sharedHitList));
                 bestMatchPfoNSharedHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, sharedHitList));
-#ifdef MONITORING
                 try
                 {
                     const Vertex *const pRecoVertex(LArPfoHelper::GetVertex(
@@ -246,7 +241,6 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
                 catch (const StatusCodeException &)
                 {
                 }
-#endif
             }
 
             if (isGoodMatch)
@@ -310,63 +304,61 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "fileIdentifier", m_fileIdentifier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", m_eventNumber - 1));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcNuanceCode", mcNuanceCode));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isNeutrino", isBeamNeutrinoFinalState));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCosmicRay", isCosmicRay));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetPrimaries", nTargetPrimaries));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexX", targetVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexY", targetVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexZ", targetVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexX", recoVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexY", recoVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexZ", recoVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryId", &mcPrimaryId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPdg", &mcPrimaryPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryE", &mcPrimaryE));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPX", &mcPrimaryPX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPY", &mcPrimaryPY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPZ", &mcPrimaryPZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxX", &mcPrimaryVtxX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxY", &mcPrimaryVtxY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxZ", &mcPrimaryVtxZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndX", &mcPrimaryEndX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndY", &mcPrimaryEndY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndZ", &mcPrimaryEndZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsTotal", &nMCHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsU", &nMCHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsV", &nMCHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsW", &nMCHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedPfos", &nPrimaryMatchedPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedNuPfos", &nPrimaryMatchedNuPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoId", &bestMatchPfoId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoPdg", &bestMatchPfoPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsRecoNu", &bestMatchPfoIsRecoNu));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoRecoNuId", &bestMatchPfoRecoNuId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsU", &bestMatchPfoNHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsV", &bestMatchPfoNHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsW", &bestMatchPfoNHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetMatches", nTargetMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetNuMatches", nTargetNuMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetCRMatches", nTargetCRMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetGoodNuMatches", nTargetGoodNuMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetNuSplits", nTargetNuSplits));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetNuLosses", nTargetNuLosses));
+            this->SetTreeVariable("fileIdentifier", m_fileIdentifier);
+            this->SetTreeVariable("eventNumber", m_eventNumber - 1);
+            this->SetTreeVariable("mcNuanceCode", mcNuanceCode);
+            this->SetTreeVariable("isNeutrino", isBeamNeutrinoFinalState);
+            this->SetTreeVariable("isCosmicRay", isCosmicRay);
+            this->SetTreeVariable("nTargetPrimaries", nTargetPrimaries);
+            this->SetTreeVariable("targetVertexX", targetVertexX);
+            this->SetTreeVariable("targetVertexY", targetVertexY);
+            this->SetTreeVariable("targetVertexZ", targetVertexZ);
+            this->SetTreeVariable("recoVertexX", recoVertexX);
+            this->SetTreeVariable("recoVertexY", recoVertexY);
+            this->SetTreeVariable("recoVertexZ", recoVertexZ);
+            this->SetTreeVariable("mcPrimaryId", &mcPrimaryId);
+            this->SetTreeVariable("mcPrimaryPdg", &mcPrimaryPdg);
+            this->SetTreeVariable("mcPrimaryE", &mcPrimaryE);
+            this->SetTreeVariable("mcPrimaryPX", &mcPrimaryPX);
+            this->SetTreeVariable("mcPrimaryPY", &mcPrimaryPY);
+            this->SetTreeVariable("mcPrimaryPZ", &mcPrimaryPZ);
+            this->SetTreeVariable("mcPrimaryVtxX", &mcPrimaryVtxX);
+            this->SetTreeVariable("mcPrimaryVtxY", &mcPrimaryVtxY);
+            this->SetTreeVariable("mcPrimaryVtxZ", &mcPrimaryVtxZ);
+            this->SetTreeVariable("mcPrimaryEndX", &mcPrimaryEndX);
+            this->SetTreeVariable("mcPrimaryEndY", &mcPrimaryEndY);
+            this->SetTreeVariable("mcPrimaryEndZ", &mcPrimaryEndZ);
+            this->SetTreeVariable("mcPrimaryNHitsTotal", &nMCHitsTotal);
+            this->SetTreeVariable("mcPrimaryNHitsU", &nMCHitsU);
+            this->SetTreeVariable("mcPrimaryNHitsV", &nMCHitsV);
+            this->SetTreeVariable("mcPrimaryNHitsW", &nMCHitsW);
+            this->SetTreeVariable("nPrimaryMatchedPfos", &nPrimaryMatchedPfos);
+            this->SetTreeVariable("nPrimaryMatchedNuPfos", &nPrimaryMatchedNuPfos);
+            this->SetTreeVariable("nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos);
+            this->SetTreeVariable("bestMatchPfoId", &bestMatchPfoId);
+            this->SetTreeVariable("bestMatchPfoPdg", &bestMatchPfoPdg);
+            this->SetTreeVariable("bestMatchPfoIsRecoNu", &bestMatchPfoIsRecoNu);
+            this->SetTreeVariable("bestMatchPfoRecoNuId", &bestMatchPfoRecoNuId);
+            this->SetTreeVariable("bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal);
+            this->SetTreeVariable("bestMatchPfoNHitsU", &bestMatchPfoNHitsU);
+            this->SetTreeVariable("bestMatchPfoNHitsV", &bestMatchPfoNHitsV);
+            this->SetTreeVariable("bestMatchPfoNHitsW", &bestMatchPfoNHitsW);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW);
+            this->SetTreeVariable("nTargetMatches", nTargetMatches);
+            this->SetTreeVariable("nTargetNuMatches", nTargetNuMatches);
+            this->SetTreeVariable("nTargetCRMatches", nTargetCRMatches);
+            this->SetTreeVariable("nTargetGoodNuMatches", nTargetGoodNuMatches);
+            this->SetTreeVariable("nTargetNuSplits", nTargetNuSplits);
+            this->SetTreeVariable("nTargetNuLosses", nTargetNuLosses);
         }
 
         if (isLastNeutrinoPrimary || isCosmicRay)
         {
             const LArInteractionTypeHelper::InteractionType interactionType(LArInteractionTypeHelper::GetInteractionType(associatedMCPrimaries));
-#ifdef MONITORING
             const int interactionTypeInt(static_cast<int>(interactionType));
-#endif
             // ATTN Some redundancy introduced to contributing variables
             const int isCorrectNu(isBeamNeutrinoFinalState && (nTargetGoodNuMatches == nTargetNuMatches) && (nTargetGoodNuMatches == nTargetPrimaries) &&
                                   (nTargetCRMatches == 0) && (nTargetNuSplits == 0) && (nTargetNuLosses == 0));
@@ -427,15 +419,15 @@ void NeutrinoEventValidationAlgorithm::ProcessOutput(
 
             if (fillTree)
             {
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "interactionType", interactionTypeInt));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectNu", isCorrectNu));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectCR", isCorrectCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeNu", isFakeNu));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeCR", isFakeCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitNu", isSplitNu));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitCR", isSplitCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isLost", isLost));
-                PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+                this->SetTreeVariable("interactionType", interactionTypeInt);
+                this->SetTreeVariable("isCorrectNu", isCorrectNu);
+                this->SetTreeVariable("isCorrectCR", isCorrectCR);
+                this->SetTreeVariable("isFakeNu", isFakeNu);
+                this->SetTreeVariable("isFakeCR", isFakeCR);
+                this->SetTreeVariable("isSplitNu", isSplitNu);
+                this->SetTreeVariable("isSplitCR", isSplitCR);
+                this->SetTreeVariable("isLost", isLost);
+                this->FillTree();
             }
 
             targetSS.str(std::string());
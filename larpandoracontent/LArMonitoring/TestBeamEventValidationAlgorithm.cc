@@ -152,11 +152,9 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
         const int mcNuanceCode(LArMCParticleHelper::GetNuanceCode(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)));
         const int isBeamParticle(LArMCParticleHelper::IsBeamParticle(pMCPrimary));
         const int isCosmicRay(LArMCParticleHelper::IsCosmicRay(pMCPrimary));
-#ifdef MONITORING
         const int nTargetPrimaries(associatedMCPrimaries.size());
         const CartesianVector &targetVertex(LArMCParticleHelper::GetParentMCParticle(pMCPrimary)->GetVertex());
         const float targetVertexX(targetVertex.GetX()), targetVertexY(targetVertex.GetY()), targetVertexZ(targetVertex.GetZ());
-#endif
 
         targetSS << (!isTargetPrimary ? "(Non target) " : "") << "PrimaryId " << mcPrimaryIndex << ", TB " << isBeamParticle << ", CR "
                  << isCosmicRay << ", MCPDG " << pMCPrimary->GetParticleId() << ", Energy " << pMCPrimary->GetEnergy() << ", Dist. "
@@ -183,10 +181,8 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
         nMCHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, mcPrimaryHitList));
 
         int matchIndex(0), nPrimaryMatches(0), nPrimaryTBMatches(0), nPrimaryCRMatches(0), nPrimaryGoodNuMatches(0);
-#ifdef MONITORING
         float recoVertexX(std::numeric_limits<float>::max()), recoVertexY(std::numeric_limits<float>::max()),
             recoVertexZ(std::numeric_limits<float>::max());
-#endif
         for (const LArMCParticleHelper::PfoCaloHitListPair &pfoToSharedHits : mcToPfoHitSharingMap.at(pMCPrimary))
         {
             const CaloHitList &sharedHitList(pfoToSharedHits.second);
@@ -212,7 +208,6 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
                 bestMatchPfoNSharedHitsW.push_back(LArMonitoringHelper::CountHitsByType(TPC_VIEW_W, sharedHitList));
                 bestMatchPfoX0.push_back(pfoToSharedHits.first->GetPropertiesMap().count("X0") ? pfoToSharedHits.first->GetPropertiesMap().at("X0")
                                                                                                : std::numeric_limits<float>::max());
-#ifdef MONITORING
                 try
                 {
                     const Vertex *const pRecoVertex(isRecoTestBeam ? LArPfoHelper::GetTestBeamInteractionVertex(pfoToSharedHits.first)
@@ -224,7 +219,6 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
                 catch (const StatusCodeException &)
                 {
                 }
-#endif
             }
 
             if (isGoodMatch)
@@ -272,60 +266,58 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
 
         if (fillTree)
         {
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "fileIdentifier", m_fileIdentifier));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "eventNumber", m_eventNumber - 1));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcNuanceCode", mcNuanceCode));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isBeamParticle", isBeamParticle));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCosmicRay", isCosmicRay));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetPrimaries", nTargetPrimaries));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexX", targetVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexY", targetVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "targetVertexZ", targetVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexX", recoVertexX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexY", recoVertexY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "recoVertexZ", recoVertexZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryId", &mcPrimaryId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPdg", &mcPrimaryPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryE", &mcPrimaryE));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPX", &mcPrimaryPX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPY", &mcPrimaryPY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryPZ", &mcPrimaryPZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxX", &mcPrimaryVtxX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxY", &mcPrimaryVtxY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryVtxZ", &mcPrimaryVtxZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndX", &mcPrimaryEndX));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndY", &mcPrimaryEndY));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryEndZ", &mcPrimaryEndZ));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsTotal", &nMCHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsU", &nMCHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsV", &nMCHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "mcPrimaryNHitsW", &nMCHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedPfos", &nPrimaryMatchedPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedTBPfos", &nPrimaryMatchedTBPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoId", &bestMatchPfoId));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoPdg", &bestMatchPfoPdg));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsU", &bestMatchPfoNHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsV", &bestMatchPfoNHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNHitsW", &bestMatchPfoNHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoX0", &bestMatchPfoX0));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetMatches", nTargetMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetTBMatches", nTargetTBMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "nTargetCRMatches", nTargetCRMatches));
-            PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "bestMatchPfoIsTB", &bestMatchPfoIsTB));
+            this->SetTreeVariable("fileIdentifier", m_fileIdentifier);
+            this->SetTreeVariable("eventNumber", m_eventNumber - 1);
+            this->SetTreeVariable("mcNuanceCode", mcNuanceCode);
+            this->SetTreeVariable("isBeamParticle", isBeamParticle);
+            this->SetTreeVariable("isCosmicRay", isCosmicRay);
+            this->SetTreeVariable("nTargetPrimaries", nTargetPrimaries);
+            this->SetTreeVariable("targetVertexX", targetVertexX);
+            this->SetTreeVariable("targetVertexY", targetVertexY);
+            this->SetTreeVariable("targetVertexZ", targetVertexZ);
+            this->SetTreeVariable("recoVertexX", recoVertexX);
+            this->SetTreeVariable("recoVertexY", recoVertexY);
+            this->SetTreeVariable("recoVertexZ", recoVertexZ);
+            this->SetTreeVariable("mcPrimaryId", &mcPrimaryId);
+            this->SetTreeVariable("mcPrimaryPdg", &mcPrimaryPdg);
+            this->SetTreeVariable("mcPrimaryE", &mcPrimaryE);
+            this->SetTreeVariable("mcPrimaryPX", &mcPrimaryPX);
+            this->SetTreeVariable("mcPrimaryPY", &mcPrimaryPY);
+            this->SetTreeVariable("mcPrimaryPZ", &mcPrimaryPZ);
+            this->SetTreeVariable("mcPrimaryVtxX", &mcPrimaryVtxX);
+            this->SetTreeVariable("mcPrimaryVtxY", &mcPrimaryVtxY);
+            this->SetTreeVariable("mcPrimaryVtxZ", &mcPrimaryVtxZ);
+            this->SetTreeVariable("mcPrimaryEndX", &mcPrimaryEndX);
+            this->SetTreeVariable("mcPrimaryEndY", &mcPrimaryEndY);
+            this->SetTreeVariable("mcPrimaryEndZ", &mcPrimaryEndZ);
+            this->SetTreeVariable("mcPrimaryNHitsTotal", &nMCHitsTotal);
+            this->SetTreeVariable("mcPrimaryNHitsU", &nMCHitsU);
+            this->SetTreeVariable("mcPrimaryNHitsV", &nMCHitsV);
+            this->SetTreeVariable("mcPrimaryNHitsW", &nMCHitsW);
+            this->SetTreeVariable("nPrimaryMatchedPfos", &nPrimaryMatchedPfos);
+            this->SetTreeVariable("nPrimaryMatchedTBPfos", &nPrimaryMatchedTBPfos);
+            this->SetTreeVariable("nPrimaryMatchedCRPfos", &nPrimaryMatchedCRPfos);
+            this->SetTreeVariable("bestMatchPfoId", &bestMatchPfoId);
+            this->SetTreeVariable("bestMatchPfoPdg", &bestMatchPfoPdg);
+            this->SetTreeVariable("bestMatchPfoNHitsTotal", &bestMatchPfoNHitsTotal);
+            this->SetTreeVariable("bestMatchPfoNHitsU", &bestMatchPfoNHitsU);
+            this->SetTreeVariable("bestMatchPfoNHitsV", &bestMatchPfoNHitsV);
+            this->SetTreeVariable("bestMatchPfoNHitsW", &bestMatchPfoNHitsW);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsTotal", &bestMatchPfoNSharedHitsTotal);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsU", &bestMatchPfoNSharedHitsU);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsV", &bestMatchPfoNSharedHitsV);
+            this->SetTreeVariable("bestMatchPfoNSharedHitsW", &bestMatchPfoNSharedHitsW);
+            this->SetTreeVariable("bestMatchPfoX0", &bestMatchPfoX0);
+            this->SetTreeVariable("nTargetMatches", nTargetMatches);
+            this->SetTreeVariable("nTargetTBMatches", nTargetTBMatches);
+            this->SetTreeVariable("nTargetCRMatches", nTargetCRMatches);
+            this->SetTreeVariable("bestMatchPfoIsTB", &bestMatchPfoIsTB);
         }
 
         if (isBeamParticle || isCosmicRay)
         {
             const LArInteractionTypeHelper::InteractionType interactionType(LArInteractionTypeHelper::GetInteractionType(associatedMCPrimaries));
-#ifdef MONITORING
             const int interactionTypeInt(static_cast<int>(interactionType));
-#endif
             // ATTN Some redundancy introduced to contributing variables
             const int isCorrectTB(isBeamParticle && (nTargetTBMatches == 1) && (nTargetCRMatches == 0));
             const int isCorrectCR(isCosmicRay && (nTargetTBMatches == 0) && (nTargetCRMatches == 1));
@@ -381,15 +373,15 @@ void TestBeamEventValidationAlgorithm::ProcessOutput(
 
             if (fillTree)
             {
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "interactionType", interactionTypeInt));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectTB", isCorrectTB));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isCorrectCR", isCorrectCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeTB", isFakeTB));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isFakeCR", isFakeCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitTB", isSplitTB));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isSplitCR", isSplitCR));
-                PANDORA_MONITORING_API(SetTreeVariable(this->GetPandora(), m_treeName.c_str(), "isLost", isLost));
-                PANDORA_MONITORING_API(FillTree(this->GetPandora(), m_treeName.c_str()));
+                this->SetTreeVariable("interactionType", interactionTypeInt);
+                this->SetTreeVariable("isCorrectTB", isCorrectTB);
+                this->SetTreeVariable("isCorrectCR", isCorrectCR);
+                this->SetTreeVariable("isFakeTB", isFakeTB);
+                this->SetTreeVariable("isFakeCR", isFakeCR);
+                this->SetTreeVariable("isSplitTB", isSplitTB);
+                this->SetTreeVariable("isSplitCR", isSplitCR);
+                this->SetTreeVariable("isLost", isLost);
+                this->FillTree();
             }
 
             targetSS.str(std::string());
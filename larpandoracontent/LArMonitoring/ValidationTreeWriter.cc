@@ -0,0 +1,80 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/ValidationTreeWriter.cc
+ *
+ *  @brief  Implementation of the validation tree writer class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArMonitoring/ValidationTreeWriter.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ValidationTreeWriter::ValidationTreeWriter() :
+    m_pAlgorithm(nullptr),
+    m_writeToTree(false),
+    m_columnarRowsPerBlock(1000)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ValidationTreeWriter::ReadColumnarSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ColumnarOutputFile", m_columnarFileName));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ColumnarRowsPerBlock", m_columnarRowsPerBlock));
+
+    if (this->IsColumnarOutputRequested() && (0 == m_columnarRowsPerBlock))
+    {
+        std::cout << "ValidationTreeWriter: ColumnarRowsPerBlock must be positive" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ValidationTreeWriter::Open(const Algorithm *const pAlgorithm, const bool writeToTree, const std::string &treeName)
+{
+    m_pAlgorithm = pAlgorithm;
+    m_writeToTree = writeToTree;
+    m_treeName = treeName;
+
+    if (this->IsColumnarOutputRequested())
+    {
+        try
+        {
+            m_pColumnarTreeWriter.reset(new ColumnarTreeWriter(m_columnarFileName, m_treeName, m_columnarRowsPerBlock));
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            return statusCodeException.GetStatusCode();
+        }
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ValidationTreeWriter::Fill() const
+{
+    if (m_writeToTree)
+    {
+        PANDORA_MONITORING_API(FillTree(m_pAlgorithm->GetPandora(), m_treeName.c_str()));
+    }
+
+    if (m_pColumnarTreeWriter)
+        m_pColumnarTreeWriter->Fill();
+}
+
+} // namespace lar_content
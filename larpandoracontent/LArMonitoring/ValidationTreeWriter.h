@@ -0,0 +1,118 @@
+/**
+ *  @file   larpandoracontent/LArMonitoring/ValidationTreeWriter.h
+ *
+ *  @brief  Header file for the validation tree writer class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_VALIDATION_TREE_WRITER_H
+#define LAR_VALIDATION_TREE_WRITER_H 1
+
+#include "Pandora/Algorithm.h"
+
+#include "larpandoracontent/LArUtility/ColumnarTreeWriter.h"
+
+#ifdef MONITORING
+#include "PandoraMonitoringApi.h"
+#endif
+
+#include <memory>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ValidationTreeWriter class, forwarding the variables of a validation tree to the monitoring tree and/or a columnar file
+ */
+class ValidationTreeWriter
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ValidationTreeWriter();
+
+    /**
+     *  @brief  Read the columnar file settings, ColumnarOutputFile and ColumnarRowsPerBlock
+     *
+     *  @param  xmlHandle the relevant xml handle
+     */
+    pandora::StatusCode ReadColumnarSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Whether a columnar file has been requested
+     *
+     *  @return boolean
+     */
+    bool IsColumnarOutputRequested() const;
+
+    /**
+     *  @brief  Open the requested outputs
+     *
+     *  @param  pAlgorithm the address of the algorithm writing the tree
+     *  @param  writeToTree whether to write to the monitoring tree
+     *  @param  treeName the tree name
+     */
+    pandora::StatusCode Open(const pandora::Algorithm *const pAlgorithm, const bool writeToTree, const std::string &treeName);
+
+    /**
+     *  @brief  Whether any output is open
+     *
+     *  @return boolean
+     */
+    bool IsWriting() const;
+
+    /**
+     *  @brief  Set a variable in the output tree, forwarding it to the monitoring tree and/or the columnar file as configured
+     *
+     *  @param  variableName the variable name
+     *  @param  t the variable value, or the address of the variable for vector variables
+     */
+    template <typename T>
+    void SetVariable(const std::string &variableName, const T &t) const;
+
+    /**
+     *  @brief  Fill the output tree, forwarding to the monitoring tree and/or the columnar file as configured
+     */
+    void Fill() const;
+
+private:
+    const pandora::Algorithm *m_pAlgorithm;                    ///< The address of the algorithm writing the tree
+    bool m_writeToTree;                                        ///< Whether to write to the monitoring tree
+    std::string m_treeName;                                    ///< The tree name
+    std::string m_columnarFileName;                            ///< Name of the optional columnar output file, written without ROOT
+    unsigned int m_columnarRowsPerBlock;                       ///< The number of rows buffered per block of the columnar output file
+    std::unique_ptr<ColumnarTreeWriter> m_pColumnarTreeWriter; ///< The columnar output file writer, if requested
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool ValidationTreeWriter::IsColumnarOutputRequested() const
+{
+    return !m_columnarFileName.empty();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool ValidationTreeWriter::IsWriting() const
+{
+    return (m_writeToTree || m_pColumnarTreeWriter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ValidationTreeWriter::SetVariable(const std::string &variableName, const T &t) const
+{
+    if (m_writeToTree)
+    {
+        PANDORA_MONITORING_API(SetTreeVariable(m_pAlgorithm->GetPandora(), m_treeName.c_str(), variableName.c_str(), t));
+    }
+
+    if (m_pColumnarTreeWriter)
+        m_pColumnarTreeWriter->SetVariable(variableName, t);
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_VALIDATION_TREE_WRITER_H
@@ -6,12 +6,14 @@
  *  $Log: $
  */
 
+#include "Objects/CaloHit.h"
 #include "Objects/Cluster.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
+#include <cmath>
 #include <iterator>
 
 using namespace pandora;
@@ -19,6 +21,28 @@ using namespace pandora;
 namespace lar_content
 {
 
+ClusterCoordinateBlock::ClusterCoordinateBlock(const Cluster *const pCluster) :
+    m_nClusterHits(pCluster->GetNCaloHits())
+{
+    m_x.reserve(m_nClusterHits);
+    m_y.reserve(m_nClusterHits);
+    m_z.reserve(m_nClusterHits);
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            m_x.push_back(position.GetX());
+            m_y.push_back(position.GetY());
+            m_z.push_back(position.GetZ());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float SimpleCone::GetMeanRT(const Cluster *const pCluster) const
 {
     CartesianPointVector hitPositionVector;
@@ -64,6 +88,53 @@ float SimpleCone::GetBoundedHitFraction(const Cluster *const pCluster, const flo
     return ((nClusterHits > 0) ? static_cast<float>(nMatchedHits) / static_cast<float>(nClusterHits) : 0.f);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void SimpleCone::GetBoundedHitFractions(const ClusterCoordinateBlock &coordinateBlock, const float coneLength, const FloatVector &coneTanHalfAngles,
+    FloatVector &boundedHitFractions) const
+{
+    const unsigned int nAngles(coneTanHalfAngles.size());
+    const unsigned int nPoints(coordinateBlock.GetX().size());
+    const float *const pX(coordinateBlock.GetX().data());
+    const float *const pY(coordinateBlock.GetY().data());
+    const float *const pZ(coordinateBlock.GetZ().data());
+
+    std::vector<unsigned int> nMatchedHits(nAngles, 0);
+
+    for (unsigned int i = 0; i < nPoints; ++i)
+    {
+        // ATTN Use the same vector operations as GetBoundedHitFraction, so that rL and rT^2 are bit-for-bit identical
+        const CartesianVector displacement(CartesianVector(pX[i], pY[i], pZ[i]) - this->GetConeApex());
+        const float rL(displacement.GetDotProduct(this->GetConeDirection()));
+
+        if ((rL < 0.f) || (rL > coneLength))
+            continue;
+
+        const float rTSquared(displacement.GetCrossProduct(this->GetConeDirection()).GetMagnitudeSquared());
+
+        for (unsigned int iAngle = 0; iAngle < nAngles; ++iAngle)
+        {
+            // Test rL * tanHalfAngle > rT via exact double precision squares. The float sqrt in GetBoundedHitFraction can only round rT up
+            // to equal the bound when the squares agree to within float precision, so only these marginal cases need the explicit sqrt
+            const float rTMax(rL * coneTanHalfAngles[iAngle]);
+
+            if (rTMax <= 0.f)
+                continue;
+
+            const double rTMaxSquared(static_cast<double>(rTMax) * static_cast<double>(rTMax));
+
+            if ((rTMaxSquared > static_cast<double>(rTSquared) * (1. + 1.e-6)) || ((rTMaxSquared > rTSquared) && (rTMax > std::sqrt(rTSquared))))
+                ++nMatchedHits[iAngle];
+        }
+    }
+
+    const unsigned int nClusterHits(coordinateBlock.GetNClusterHits());
+    boundedHitFractions.clear();
+
+    for (const unsigned int nMatched : nMatchedHits)
+        boundedHitFractions.push_back((nClusterHits > 0) ? static_cast<float>(nMatched) / static_cast<float>(nClusterHits) : 0.f);
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
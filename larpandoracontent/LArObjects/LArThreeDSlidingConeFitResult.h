@@ -30,6 +30,58 @@ enum ConeSelection
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  ClusterCoordinateBlock class, a structure-of-arrays copy of the hit positions in a cluster, for repeated cone containment tests
+ */
+class ClusterCoordinateBlock
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pCluster the address of the cluster
+     */
+    ClusterCoordinateBlock(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the number of calo hits in the cluster
+     *
+     *  @return the number of calo hits in the cluster
+     */
+    unsigned int GetNClusterHits() const;
+
+    /**
+     *  @brief  Get the hit x coordinates
+     *
+     *  @return the hit x coordinates
+     */
+    const pandora::FloatVector &GetX() const;
+
+    /**
+     *  @brief  Get the hit y coordinates
+     *
+     *  @return the hit y coordinates
+     */
+    const pandora::FloatVector &GetY() const;
+
+    /**
+     *  @brief  Get the hit z coordinates
+     *
+     *  @return the hit z coordinates
+     */
+    const pandora::FloatVector &GetZ() const;
+
+private:
+    unsigned int m_nClusterHits; ///< The number of calo hits in the cluster
+    pandora::FloatVector m_x;    ///< The hit x coordinates
+    pandora::FloatVector m_y;    ///< The hit y coordinates
+    pandora::FloatVector m_z;    ///< The hit z coordinates
+};
+
+typedef std::unordered_map<const pandora::Cluster *, ClusterCoordinateBlock> ClusterCoordinateBlockMap;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  SimpleCone class
  */
@@ -103,6 +155,18 @@ public:
      */
     float GetBoundedHitFraction(const pandora::Cluster *const pCluster, const float coneLength, const float coneTanHalfAngle) const;
 
+    /**
+     *  @brief  Get the fractions of hits in a cluster that are bounded within the cone, for several cone half-angles in a single pass over
+     *          cached hit coordinates. The fractions are identical to those from GetBoundedHitFraction for each half-angle in turn
+     *
+     *  @param  coordinateBlock the cached hit coordinates of the cluster
+     *  @param  coneLength the provided cone length
+     *  @param  coneTanHalfAngles the provided tangents of the cone half-angles
+     *  @param  boundedHitFractions to receive the bounded hit fractions, one per cone half-angle
+     */
+    void GetBoundedHitFractions(const ClusterCoordinateBlock &coordinateBlock, const float coneLength, const pandora::FloatVector &coneTanHalfAngles,
+        pandora::FloatVector &boundedHitFractions) const;
+
 private:
     pandora::CartesianVector m_coneApex;      ///< The cone apex
     pandora::CartesianVector m_coneDirection; ///< The cone direction
@@ -170,6 +234,35 @@ typedef std::unordered_map<const pandora::Cluster *, ThreeDSlidingConeFitResult>
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int ClusterCoordinateBlock::GetNClusterHits() const
+{
+    return m_nClusterHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::FloatVector &ClusterCoordinateBlock::GetX() const
+{
+    return m_x;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::FloatVector &ClusterCoordinateBlock::GetY() const
+{
+    return m_y;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::FloatVector &ClusterCoordinateBlock::GetZ() const
+{
+    return m_z;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline SimpleCone::SimpleCone(const pandora::CartesianVector &coneApex, const pandora::CartesianVector &coneDirection,
     const float coneLength, const float coneTanHalfAngle) :
     m_coneApex(coneApex),
@@ -47,9 +47,7 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     else
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
-        LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
-        this->FillLayerFitContributionMap(constituentHitPointVector);
+        this->FillLayerFitContributionMap(pCluster, 0.5f, 1.f);
     }
 
     this->PerformSlidingLinearFit();
@@ -97,9 +95,7 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const
     else
     {
         // TODO Refactor hit splitting and ensure all parameters configurable
-        LArHitWidthHelper::ConstituentHitVector constituentHitVector(LArHitWidthHelper::GetConstituentHits(pCluster, 0.5f, 1.f, true));
-        const CartesianPointVector constituentHitPointVector(LArHitWidthHelper::GetConstituentHitPositionVector(constituentHitVector));
-        this->FillLayerFitContributionMap(constituentHitPointVector);
+        this->FillLayerFitContributionMap(pCluster, 0.5f, 1.f);
     }
 
     this->PerformSlidingLinearFit();
@@ -140,6 +136,72 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const unsigned int layerFitHalfWindow
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TwoDSlidingFitResult::TwoDSlidingFitResult(const TwoDSlidingFitResult &parentFitResult, const Cluster *const pCluster, const int minLayer,
+    const int maxLayer, const LayerFitContributionMap &boundaryContributionMap) :
+    m_pCluster(pCluster),
+    m_layerFitHalfWindow(parentFitResult.m_layerFitHalfWindow),
+    m_layerPitch(parentFitResult.m_layerPitch),
+    m_axisIntercept(parentFitResult.m_axisIntercept),
+    m_axisDirection(parentFitResult.m_axisDirection),
+    m_orthoDirection(parentFitResult.m_orthoDirection)
+{
+    if (minLayer > maxLayer)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const LayerFitContributionMap &parentContributionMap(parentFitResult.GetLayerFitContributionMap());
+
+    for (LayerFitContributionMap::const_iterator iter = parentContributionMap.upper_bound(minLayer), iterEnd = parentContributionMap.end();
+         (iter != iterEnd) && (iter->first < maxLayer); ++iter)
+    {
+        m_layerFitContributionMap.insert(*iter);
+    }
+
+    for (const int boundaryLayer : {minLayer, maxLayer})
+    {
+        LayerFitContributionMap::const_iterator boundaryIter(boundaryContributionMap.find(boundaryLayer));
+
+        if (boundaryContributionMap.end() != boundaryIter)
+            m_layerFitContributionMap.insert(*boundaryIter);
+    }
+
+    if (m_layerFitContributionMap.empty())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // A sliding window that does not reach an end layer holds exactly the parent contributions, so the parent fit result is reused
+    // ATTN Reuse is restricted to [innerLayer, outerLayer], the layers a fit calculated from scratch would cover for this fragment
+    const int innerLayer(m_layerFitContributionMap.begin()->first);
+    const int outerLayer(m_layerFitContributionMap.rbegin()->first);
+    const int layerFitHalfWindow(static_cast<int>(m_layerFitHalfWindow));
+    const int lowRefitLayer(std::max(innerLayer, std::min(outerLayer, minLayer + layerFitHalfWindow)));
+    const int highRefitLayer(std::min(outerLayer, std::max(innerLayer, maxLayer - layerFitHalfWindow)));
+
+    if (lowRefitLayer + 1 >= highRefitLayer)
+    {
+        this->PerformSlidingLinearFit(innerLayer, outerLayer);
+    }
+    else
+    {
+        this->PerformSlidingLinearFit(innerLayer, lowRefitLayer);
+
+        const LayerFitResultMap &parentResultMap(parentFitResult.GetLayerFitResultMap());
+
+        for (LayerFitResultMap::const_iterator iter = parentResultMap.upper_bound(lowRefitLayer), iterEnd = parentResultMap.end();
+             (iter != iterEnd) && (iter->first < highRefitLayer); ++iter)
+        {
+            m_layerFitResultMap.insert(*iter);
+        }
+
+        this->PerformSlidingLinearFit(highRefitLayer, outerLayer);
+    }
+
+    if (m_layerFitResultMap.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    this->FindSlidingFitSegments();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const pandora::Cluster *TwoDSlidingFitResult::GetCluster() const
 {
     if (!m_pCluster)
@@ -619,6 +681,28 @@ void TwoDSlidingFitResult::CalculateAxes(const CartesianPointVector &coordinateV
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDSlidingFitResult::FillLayerFitContributionMap(const CartesianPointVector &coordinateVector)
+{
+    this->CheckLayerFitContributionMapInputs();
+
+    for (CartesianPointVector::const_iterator iter = coordinateVector.begin(), iterEnd = coordinateVector.end(); iter != iterEnd; ++iter)
+        this->AddLayerFitContribution(*iter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::FillLayerFitContributionMap(
+    const Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor)
+{
+    this->CheckLayerFitContributionMapInputs();
+
+    // ATTN Constituent hit positions are added as they are generated, in the same order as the uniform GetConstituentHits output
+    LArHitWidthHelper::VisitConstituentHits(pCluster, maxConstituentHitWidth, hitWidthScalingFactor, true,
+        [this](const CartesianVector &position, const float) { this->AddLayerFitContribution(position); });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::CheckLayerFitContributionMapInputs() const
 {
     if (m_layerPitch < std::numeric_limits<float>::epsilon())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
@@ -629,13 +713,15 @@ void TwoDSlidingFitResult::FillLayerFitContributionMap(const CartesianPointVecto
 
     if (!m_layerFitContributionMap.empty())
         throw StatusCodeException(STATUS_CODE_FAILURE);
+}
 
-    for (CartesianPointVector::const_iterator iter = coordinateVector.begin(), iterEnd = coordinateVector.end(); iter != iterEnd; ++iter)
-    {
-        float rL(0.f), rT(0.f);
-        this->GetLocalPosition(*iter, rL, rT);
-        m_layerFitContributionMap[this->GetLayer(rL)].AddPoint(rL, rT);
-    }
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::AddLayerFitContribution(const CartesianVector &position)
+{
+    float rL(0.f), rT(0.f);
+    this->GetLocalPosition(position, rL, rT);
+    m_layerFitContributionMap[this->GetLayer(rL)].AddPoint(rL, rT);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -648,14 +734,24 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
     if ((m_layerPitch < std::numeric_limits<float>::epsilon()) || (m_layerFitContributionMap.empty()))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    this->PerformSlidingLinearFit(m_layerFitContributionMap.begin()->first, m_layerFitContributionMap.rbegin()->first);
+
+    if (m_layerFitResultMap.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::PerformSlidingLinearFit(const int firstLayer, const int lastLayer)
+{
     unsigned int slidingNPoints(0);
     double slidingSumT(0.), slidingSumL(0.), slidingSumTT(0.), slidingSumLT(0.), slidingSumLL(0.);
 
     const LayerFitContributionMap &layerFitContributionMap(this->GetLayerFitContributionMap());
-    const int innerLayer(layerFitContributionMap.begin()->first);
     const int layerFitHalfWindow(static_cast<int>(this->GetLayerFitHalfWindow()));
 
-    for (int iLayer = innerLayer; iLayer < innerLayer + layerFitHalfWindow; ++iLayer)
+    // ATTN Include the layer that leaves the window at the first step, so that the fit can also start part way through the cluster
+    for (int iLayer = firstLayer - layerFitHalfWindow - 1; iLayer < firstLayer + layerFitHalfWindow; ++iLayer)
     {
         LayerFitContributionMap::const_iterator lyrIter = layerFitContributionMap.find(iLayer);
 
@@ -670,9 +766,7 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
         }
     }
 
-    const int outerLayer(layerFitContributionMap.rbegin()->first);
-
-    for (int iLayer = innerLayer; iLayer <= outerLayer; ++iLayer)
+    for (int iLayer = firstLayer; iLayer <= lastLayer; ++iLayer)
     {
         const int fwdLayer(iLayer + layerFitHalfWindow);
         LayerFitContributionMap::const_iterator fwdIter = layerFitContributionMap.find(fwdLayer);
@@ -734,9 +828,6 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
         const LayerFitResult layerFitResult(l, fitT, gradient, rms);
         (void)m_layerFitResultMap.insert(LayerFitResultMap::value_type(iLayer, layerFitResult));
     }
-
-    if (m_layerFitResultMap.empty())
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -69,6 +69,21 @@ public:
         const pandora::CartesianVector &axisDirection, const pandora::CartesianVector &orthoDirection,
         const LayerFitContributionMap &layerFitContributionMap);
 
+    /**
+     *  @brief  Constructor for a fit to the points of a parent fit lying in a contiguous range of layers, using the parent axes. The
+     *          parent layer fit contributions are reused, other than for the two end layers of the range, which are taken from the
+     *          provided boundary contributions, as the parent end layers may include points outside the subset. Only the sliding
+     *          windows reaching an end layer are refitted, with the parent layer fit results reused elsewhere.
+     *
+     *  @param  parentFitResult the parent sliding fit result
+     *  @param  pCluster address of the cluster holding the subset of points, if any
+     *  @param  minLayer the first layer in the range
+     *  @param  maxLayer the last layer in the range
+     *  @param  boundaryContributionMap the layer fit contributions of the subset in the first and last layers of the range
+     */
+    TwoDSlidingFitResult(const TwoDSlidingFitResult &parentFitResult, const pandora::Cluster *const pCluster, const int minLayer,
+        const int maxLayer, const LayerFitContributionMap &boundaryContributionMap);
+
     /**
      *  @brief  Get the address of the cluster, if originally provided
      *
@@ -409,11 +424,40 @@ private:
      */
     void FillLayerFitContributionMap(const pandora::CartesianPointVector &coordinateVector);
 
+    /**
+     *  @brief  Fill the layer fit contribution map using the positions of the uniform constituent hits of a cluster, without storing them
+     *
+     *  @param  pCluster the address of the cluster
+     *  @param  maxConstituentHitWidth the maximum width of a constituent hit
+     *  @param  hitWidthScalingFactor the constituent hit width scaling factor
+     */
+    void FillLayerFitContributionMap(const pandora::Cluster *const pCluster, const float maxConstituentHitWidth, const float hitWidthScalingFactor);
+
+    /**
+     *  @brief  Check that the fit axes and layer pitch are valid, and that the layer fit contribution map is yet to be filled
+     */
+    void CheckLayerFitContributionMapInputs() const;
+
+    /**
+     *  @brief  Add a position to the layer fit contribution map
+     *
+     *  @param  position the position
+     */
+    void AddLayerFitContribution(const pandora::CartesianVector &position);
+
     /**
      *  @brief  Perform the sliding linear fit
      */
     void PerformSlidingLinearFit();
 
+    /**
+     *  @brief  Perform the sliding linear fit for a range of layers, filling the layer fit result map
+     *
+     *  @param  firstLayer the first layer for which to calculate a fit result
+     *  @param  lastLayer the last layer for which to calculate a fit result
+     */
+    void PerformSlidingLinearFit(const int firstLayer, const int lastLayer);
+
     /**
      *  @brief  Find sliding fit segments; sections with tramsverse direction
      */
@@ -156,6 +156,69 @@ TwoDSlidingFitResult TwoDSlidingShowerFitResult::LArTwoDShowerEdgeFit(const Cart
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ShowerEdgeArray::ShowerEdgeArray(const int firstBin, const unsigned int nBins) :
+    m_firstBin(firstBin),
+    m_lowEdgeZ(nBins, std::numeric_limits<float>::max()),
+    m_highEdgeZ(nBins, -std::numeric_limits<float>::max())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ShowerEdgeArray::ShowerEdgeArray(const ShowerPositionMap &showerPositionMap) :
+    ShowerEdgeArray(showerPositionMap.empty() ? 0 : showerPositionMap.begin()->first,
+        showerPositionMap.empty() ? 0 : 1 + showerPositionMap.rbegin()->first - showerPositionMap.begin()->first)
+{
+    for (const ShowerPositionMap::value_type &mapEntry : showerPositionMap)
+        this->SetEdges(mapEntry.first, mapEntry.second.GetLowEdgeZ(), mapEntry.second.GetHighEdgeZ());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ShowerEdgeArray::SetEdges(const int xBin, const float edge1, const float edge2)
+{
+    if ((xBin < m_firstBin) || (static_cast<unsigned int>(xBin - m_firstBin) >= m_lowEdgeZ.size()))
+        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+    if (this->IsPopulated(xBin))
+        return;
+
+    m_lowEdgeZ[xBin - m_firstBin] = std::min(edge1, edge2);
+    m_highEdgeZ[xBin - m_firstBin] = std::max(edge1, edge2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+XSortedHits::XSortedHits(const Cluster *const pCluster) :
+    m_pCluster(pCluster)
+{
+    // ATTN Collect positions directly, as GetCoordinateVector would sort by full position only for the order to be discarded here
+    CartesianPointVector positionVector;
+    positionVector.reserve(pCluster->GetNCaloHits());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+            positionVector.push_back(pCaloHit->GetPositionVector());
+    }
+
+    std::sort(positionVector.begin(), positionVector.end(),
+        [](const CartesianVector &lhs, const CartesianVector &rhs) { return (lhs.GetX() < rhs.GetX()); });
+
+    m_x.reserve(positionVector.size());
+    m_z.reserve(positionVector.size());
+
+    for (const CartesianVector &position : positionVector)
+    {
+        m_x.push_back(position.GetX());
+        m_z.push_back(position.GetZ());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(const pandora::Cluster *const, const unsigned int, const float, const float);
 template TwoDSlidingShowerFitResult::TwoDSlidingShowerFitResult(const pandora::CartesianPointVector *const, const unsigned int, const float, const float);
 
@@ -161,6 +161,83 @@ private:
 
 typedef std::map<int, ShowerExtent> ShowerPositionMap;
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  ShowerEdgeArray class, a dense representation of the shower edge envelope, indexed by x sampling bin
+ */
+class ShowerEdgeArray
+{
+public:
+    /**
+     *  @brief  Constructor, for an array without shower edges
+     *
+     *  @param  firstBin the x sampling bin corresponding to the first array entry
+     *  @param  nBins the number of x sampling bins
+     */
+    ShowerEdgeArray(const int firstBin, const unsigned int nBins);
+
+    /**
+     *  @brief  Constructor, copying the shower edges of a shower position map
+     *
+     *  @param  showerPositionMap the shower position map
+     */
+    ShowerEdgeArray(const ShowerPositionMap &showerPositionMap);
+
+    /**
+     *  @brief  Whether the shower edges have been set for a given x sampling bin
+     *
+     *  @param  xBin the x sampling bin
+     *
+     *  @return boolean, false for bins outside the array
+     */
+    bool IsPopulated(const int xBin) const;
+
+    /**
+     *  @brief  Set the shower edges for a given x sampling bin, if not already populated, matching std::map insert behaviour
+     *
+     *  @param  xBin the x sampling bin
+     *  @param  edge1 the first shower edge z coordinate
+     *  @param  edge2 the second shower edge z coordinate
+     */
+    void SetEdges(const int xBin, const float edge1, const float edge2);
+
+    /**
+     *  @brief  Whether a z coordinate lies strictly between the shower edges for a given x sampling bin
+     *
+     *  @param  xBin the x sampling bin
+     *  @param  z the z coordinate
+     *
+     *  @return boolean, false for bins without shower edges
+     */
+    bool IsContained(const int xBin, const float z) const;
+
+private:
+    int m_firstBin;                   ///< The x sampling bin corresponding to the first array entry
+    pandora::FloatVector m_lowEdgeZ;  ///< The shower low edge z coordinates, max float for unpopulated bins
+    pandora::FloatVector m_highEdgeZ; ///< The shower high edge z coordinates, -max float for unpopulated bins
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  XSortedHits class, the hit coordinates of a cluster, sorted by x
+ */
+class XSortedHits
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pCluster address of the cluster
+     */
+    XSortedHits(const pandora::Cluster *const pCluster);
+
+    const pandora::Cluster *m_pCluster; ///< The address of the cluster
+    pandora::FloatVector m_x;           ///< The hit x coordinates, in increasing x order
+    pandora::FloatVector m_z;           ///< The hit z coordinates, in matching order
+};
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -214,6 +291,27 @@ inline float ShowerExtent::GetLowEdgeZ() const
     return m_lowEdgeZ;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool ShowerEdgeArray::IsPopulated(const int xBin) const
+{
+    if ((xBin < m_firstBin) || (static_cast<unsigned int>(xBin - m_firstBin) >= m_lowEdgeZ.size()))
+        return false;
+
+    return (m_lowEdgeZ[xBin - m_firstBin] <= m_highEdgeZ[xBin - m_firstBin]);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool ShowerEdgeArray::IsContained(const int xBin, const float z) const
+{
+    if ((xBin < m_firstBin) || (static_cast<unsigned int>(xBin - m_firstBin) >= m_lowEdgeZ.size()))
+        return false;
+
+    return ((z > m_lowEdgeZ[xBin - m_firstBin]) && (z < m_highEdgeZ[xBin - m_firstBin]));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_TWO_D_SLIDING_SHOWER_FIT_RESULT_H
@@ -20,7 +20,11 @@ using namespace pandora;
 namespace lar_content
 {
 
-DeltaRayMatchingContainers::DeltaRayMatchingContainers() : m_searchRegion1D(3.f)
+DeltaRayMatchingContainers::DeltaRayMatchingContainers() :
+    m_searchRegion1D(3.f),
+    m_nStaleHitsU(0),
+    m_nStaleHitsV(0),
+    m_nStaleHitsW(0)
 {
 }
 
@@ -54,12 +58,33 @@ void DeltaRayMatchingContainers::AddToClusterMap(const Cluster *const pCluster)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
     HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
+    const CaloHitSet &indexedHits((hitType == TPC_VIEW_U) ? m_indexedHitsU : (hitType == TPC_VIEW_V) ? m_indexedHitsV : m_indexedHitsW);
+    CaloHitVector &unindexedHits((hitType == TPC_VIEW_U) ? m_unindexedHitsU : (hitType == TPC_VIEW_V) ? m_unindexedHitsV : m_unindexedHitsW);
+    unsigned int &nStaleHits((hitType == TPC_VIEW_U) ? m_nStaleHitsU : (hitType == TPC_VIEW_V) ? m_nStaleHitsV : m_nStaleHitsW);
 
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
     for (const CaloHit *const pCaloHit : caloHitList)
-        hitToClusterMap[pCaloHit] = pCluster;
+    {
+        const std::pair<HitToClusterMap::iterator, bool> insertion(hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster)));
+
+        if (!insertion.second)
+        {
+            insertion.first->second = pCluster;
+            continue;
+        }
+
+        // A hit returning to the map revives its KD tree record, otherwise it must be searched exhaustively until the next rebuild
+        if (indexedHits.count(pCaloHit))
+        {
+            --nStaleHits;
+        }
+        else
+        {
+            unindexedHits.push_back(pCaloHit);
+        }
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -83,16 +108,42 @@ void DeltaRayMatchingContainers::BuildKDTree(const HitType hitType)
 {
     const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
     HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
+    CaloHitSet &indexedHits((hitType == TPC_VIEW_U) ? m_indexedHitsU : (hitType == TPC_VIEW_V) ? m_indexedHitsV : m_indexedHitsW);
+    CaloHitVector &unindexedHits((hitType == TPC_VIEW_U) ? m_unindexedHitsU : (hitType == TPC_VIEW_V) ? m_unindexedHitsV : m_unindexedHitsW);
+    unsigned int &nStaleHits((hitType == TPC_VIEW_U) ? m_nStaleHitsU : (hitType == TPC_VIEW_V) ? m_nStaleHitsV : m_nStaleHitsW);
 
-    CaloHitList allCaloHits;
+    CaloHitVector allCaloHitVector;
+    allCaloHitVector.reserve(hitToClusterMap.size());
 
     for (auto &entry : hitToClusterMap)
-        allCaloHits.push_back(entry.first);
+        allCaloHitVector.push_back(entry.first);
+
+    // ATTN: Hash map iteration order is not reproducible, so order the hits before building the tree
+    std::sort(allCaloHitVector.begin(), allCaloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+    const CaloHitList allCaloHits(allCaloHitVector.begin(), allCaloHitVector.end());
 
     HitKDNode2DList hitKDNode2DList;
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
 
+    kdTree.clear();
     kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    indexedHits = CaloHitSet(allCaloHitVector.begin(), allCaloHitVector.end());
+    unindexedHits.clear();
+    nStaleHits = 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::CompactKDTree(const HitType hitType)
+{
+    const CaloHitSet &indexedHits((hitType == TPC_VIEW_U) ? m_indexedHitsU : (hitType == TPC_VIEW_V) ? m_indexedHitsV : m_indexedHitsW);
+    const CaloHitVector &unindexedHits((hitType == TPC_VIEW_U) ? m_unindexedHitsU : (hitType == TPC_VIEW_V) ? m_unindexedHitsV : m_unindexedHitsW);
+    const unsigned int nStaleHits((hitType == TPC_VIEW_U) ? m_nStaleHitsU : (hitType == TPC_VIEW_V) ? m_nStaleHitsV : m_nStaleHitsW);
+
+    // Stale hits cost a wasted lookup and unindexed hits an exhaustive comparison, so rebuild once they amount to a quarter of the tree
+    if (4 * (nStaleHits + unindexedHits.size()) > indexedHits.size())
+        this->BuildKDTree(hitType);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -100,39 +151,138 @@ void DeltaRayMatchingContainers::BuildKDTree(const HitType hitType)
 void DeltaRayMatchingContainers::AddToClusterProximityMap(const Cluster *const pCluster)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pCluster));
+
+    this->CompactKDTree(hitType);
+
     const HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
     HitKDTree2D &kdTree((hitType == TPC_VIEW_U) ? m_kdTreeU : (hitType == TPC_VIEW_V) ? m_kdTreeV : m_kdTreeW);
+    const CaloHitVector &unindexedHits((hitType == TPC_VIEW_U) ? m_unindexedHitsU : (hitType == TPC_VIEW_V) ? m_unindexedHitsV : m_unindexedHitsW);
     ClusterProximityMap &clusterProximityMap(
         (hitType == TPC_VIEW_U) ? m_clusterProximityMapU : (hitType == TPC_VIEW_V) ? m_clusterProximityMapV : m_clusterProximityMapW);
 
+    // Collect each nearby cluster once, in the order in which it is first found
+    ClusterSet foundClusters;
+    ClusterVector nearbyClusterVector;
     CaloHitList caloHitList;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
 
+    // Select, once per cluster, the unindexed hits within the search region of the cluster bounding box, then order them in x
+    HitKDNode2DList candidateHits;
+
+    if (!unindexedHits.empty())
+    {
+        KDTreeBox clusterRegion(build_2d_kd_search_region(caloHitList.front(), m_searchRegion1D, m_searchRegion1D));
+
+        for (const CaloHit *const pCaloHit : caloHitList)
+        {
+            const KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
+
+            for (unsigned int i = 0; i < 2; ++i)
+            {
+                clusterRegion.dimmin[i] = std::min(clusterRegion.dimmin[i], searchRegionHits.dimmin[i]);
+                clusterRegion.dimmax[i] = std::max(clusterRegion.dimmax[i], searchRegionHits.dimmax[i]);
+            }
+        }
+
+        for (const CaloHit *const pUnindexedHit : unindexedHits)
+        {
+            const CartesianVector &position(pUnindexedHit->GetPositionVector());
+
+            if ((position.GetX() >= clusterRegion.dimmin[0]) && (position.GetX() <= clusterRegion.dimmax[0]) &&
+                (position.GetZ() >= clusterRegion.dimmin[1]) && (position.GetZ() <= clusterRegion.dimmax[1]))
+            {
+                candidateHits.emplace_back(pUnindexedHit, position.GetX(), position.GetZ());
+            }
+        }
+
+        std::stable_sort(candidateHits.begin(), candidateHits.end(),
+            [](const HitKDNode2D &lhs, const HitKDNode2D &rhs) { return (lhs.dims[0] < rhs.dims[0]); });
+    }
+
+    // ATTN Search region is padded, as the kd tree search excludes hits on its region boundaries, e.g. coincident hits for a zero width region.
+    // Indexed and unindexed hits are then accepted by the same test against the unpadded region.
+    const float paddedSearchRegion1D(1.01f * m_searchRegion1D + 0.01f);
+
     for (const CaloHit *const pCaloHit : caloHitList)
     {
+        const KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
+        const auto isInSearchRegion = [&searchRegionHits](const float x, const float z) {
+            return ((x >= searchRegionHits.dimmin[0]) && (x <= searchRegionHits.dimmax[0]) && (z >= searchRegionHits.dimmin[1]) &&
+                (z <= searchRegionHits.dimmax[1]));
+        };
+
         HitKDNode2DList found;
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
+        kdTree.search(build_2d_kd_search_region(pCaloHit, paddedSearchRegion1D, paddedSearchRegion1D), found);
+
+        HitKDNode2DList::const_iterator candidateIter(std::lower_bound(candidateHits.begin(), candidateHits.end(), searchRegionHits.dimmin[0],
+            [](const HitKDNode2D &candidate, const float x) { return (candidate.dims[0] < x); }));
 
-        kdTree.search(searchRegionHits, found);
+        for (; (candidateIter != candidateHits.end()) && (candidateIter->dims[0] <= searchRegionHits.dimmax[0]); ++candidateIter)
+        {
+            if (isInSearchRegion(candidateIter->dims[0], candidateIter->dims[1]))
+                found.push_back(*candidateIter);
+        }
 
         for (const auto &hit : found)
         {
-            const Cluster *const pNearbyCluster(hitToClusterMap.at(hit.data));
+            if (!isInSearchRegion(hit.dims[0], hit.dims[1]))
+                continue;
+
+            // ATTN: The KD tree retains the hits of removed clusters until it is next rebuilt
+            const HitToClusterMap::const_iterator hitIter(hitToClusterMap.find(hit.data));
+
+            if (hitIter == hitToClusterMap.end())
+                continue;
+
+            const Cluster *const pNearbyCluster(hitIter->second);
 
             if (pNearbyCluster == pCluster)
                 continue;
 
-            ClusterList &nearbyClusterList(clusterProximityMap[pCluster]);
+            if (foundClusters.insert(pNearbyCluster).second)
+                nearbyClusterVector.push_back(pNearbyCluster);
+        }
+    }
 
-            if (std::find(nearbyClusterList.begin(), nearbyClusterList.end(), pNearbyCluster) == nearbyClusterList.end())
-                nearbyClusterList.push_back(pNearbyCluster);
+    for (const Cluster *const pNearbyCluster : nearbyClusterVector)
+        this->AddProximity(pCluster, pNearbyCluster, clusterProximityMap);
+}
 
-            ClusterList &invertedNearbyClusterList(clusterProximityMap[pNearbyCluster]);
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-            if (std::find(invertedNearbyClusterList.begin(), invertedNearbyClusterList.end(), pCluster) == invertedNearbyClusterList.end())
-                invertedNearbyClusterList.push_back(pCluster);
-        }
+void DeltaRayMatchingContainers::AddProximity(const Cluster *const pCluster1, const Cluster *const pCluster2, ClusterProximityMap &clusterProximityMap) const
+{
+    // ATTN: Proximity is symmetric, so a single membership test covers the entries of both clusters
+    if (!clusterProximityMap[pCluster1].Insert(pCluster2))
+        return;
+
+    clusterProximityMap[pCluster2].Insert(pCluster1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DeltaRayMatchingContainers::RemoveProximity(const Cluster *const pCluster, ClusterProximityMap &clusterProximityMap) const
+{
+    const ClusterProximityMap::iterator clusterProximityIter(clusterProximityMap.find(pCluster));
+
+    if (clusterProximityIter == clusterProximityMap.end())
+        return;
+
+    for (const Cluster *const pNearbyCluster : clusterProximityIter->second)
+    {
+        const ClusterProximityMap::iterator iter(clusterProximityMap.find(pNearbyCluster));
+
+        if (iter == clusterProximityMap.end())
+            continue;
+
+        iter->second.Erase(pCluster);
+
+        // ATTN: Remove emptied entries, so that the map matches one filled from scratch
+        if (iter->second.empty())
+            clusterProximityMap.erase(iter);
     }
+
+    clusterProximityMap.erase(clusterProximityIter);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -189,6 +339,8 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(pDeletedCluster));
     HitToClusterMap &hitToClusterMap((hitType == TPC_VIEW_U) ? m_hitToClusterMapU : (hitType == TPC_VIEW_V) ? m_hitToClusterMapV : m_hitToClusterMapW);
+    const CaloHitSet &indexedHits((hitType == TPC_VIEW_U) ? m_indexedHitsU : (hitType == TPC_VIEW_V) ? m_indexedHitsV : m_indexedHitsW);
+    unsigned int &nStaleHits((hitType == TPC_VIEW_U) ? m_nStaleHitsU : (hitType == TPC_VIEW_V) ? m_nStaleHitsV : m_nStaleHitsW);
     ClusterProximityMap &clusterProximityMap(
         (hitType == TPC_VIEW_U) ? m_clusterProximityMapU : (hitType == TPC_VIEW_V) ? m_clusterProximityMapV : m_clusterProximityMapW);
     ClusterToPfoMap &clusterToPfoMap((hitType == TPC_VIEW_U) ? m_clusterToPfoMapU : (hitType == TPC_VIEW_V) ? m_clusterToPfoMapV : m_clusterToPfoMapW);
@@ -204,30 +356,13 @@ void DeltaRayMatchingContainers::RemoveClusterFromContainers(const Cluster *cons
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
         hitToClusterMap.erase(iter);
-    }
-
-    const ClusterProximityMap::const_iterator clusterProximityIter(clusterProximityMap.find(pDeletedCluster));
 
-    if (clusterProximityIter != clusterProximityMap.end())
-    {
-        const ClusterList &nearbyClusterList(clusterProximityIter->second);
-
-        for (const Cluster *const pNearbyCluster : nearbyClusterList)
-        {
-            const ClusterProximityMap::iterator iter(clusterProximityMap.find(pNearbyCluster));
-
-            if (iter == clusterProximityMap.end())
-                continue;
-
-            ClusterList &invertedCloseClusters(iter->second);
-
-            ClusterList::iterator invertedIter(std::find(invertedCloseClusters.begin(), invertedCloseClusters.end(), pDeletedCluster));
-            invertedCloseClusters.erase(invertedIter);
-        }
-
-        clusterProximityMap.erase(clusterProximityIter);
+        if (indexedHits.count(pCaloHit))
+            ++nStaleHits;
     }
 
+    this->RemoveProximity(pDeletedCluster, clusterProximityMap);
+
     const DeltaRayMatchingContainers::ClusterToPfoMap::const_iterator clusterToPfoIter(clusterToPfoMap.find(pDeletedCluster));
 
     if (clusterToPfoIter != clusterToPfoMap.end())
@@ -246,6 +381,18 @@ void DeltaRayMatchingContainers::ClearContainers()
     m_kdTreeV.clear();
     m_kdTreeW.clear();
 
+    m_indexedHitsU.clear();
+    m_indexedHitsV.clear();
+    m_indexedHitsW.clear();
+
+    m_unindexedHitsU.clear();
+    m_unindexedHitsV.clear();
+    m_unindexedHitsW.clear();
+
+    m_nStaleHitsU = 0;
+    m_nStaleHitsV = 0;
+    m_nStaleHitsW = 0;
+
     m_clusterProximityMapU.clear();
     m_clusterProximityMapV.clear();
     m_clusterProximityMapW.clear();
@@ -255,4 +402,54 @@ void DeltaRayMatchingContainers::ClearContainers()
     m_clusterToPfoMapW.clear();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DeltaRayMatchingContainers::NearbyClusters::NearbyClusters(const NearbyClusters &rhs)
+{
+    *this = rhs;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DeltaRayMatchingContainers::NearbyClusters &DeltaRayMatchingContainers::NearbyClusters::operator=(const NearbyClusters &rhs)
+{
+    if (this == &rhs)
+        return *this;
+
+    // ATTN: The look-up holds iterators into the owning cluster list, so it is rebuilt rather than copied
+    m_clusterList.clear();
+    m_clusterToIteratorMap.clear();
+
+    for (const Cluster *const pCluster : rhs)
+        this->Insert(pCluster);
+
+    return *this;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DeltaRayMatchingContainers::NearbyClusters::Insert(const Cluster *const pCluster)
+{
+    if (this->Contains(pCluster))
+        return false;
+
+    m_clusterToIteratorMap.emplace(pCluster, m_clusterList.insert(m_clusterList.end(), pCluster));
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DeltaRayMatchingContainers::NearbyClusters::Erase(const Cluster *const pCluster)
+{
+    const ClusterToIteratorMap::iterator iter(m_clusterToIteratorMap.find(pCluster));
+
+    if (iter == m_clusterToIteratorMap.end())
+        return false;
+
+    m_clusterList.erase(iter->second);
+    m_clusterToIteratorMap.erase(iter);
+    return true;
+}
+
 } // namespace lar_content
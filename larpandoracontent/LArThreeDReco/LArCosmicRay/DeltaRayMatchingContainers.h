@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -21,8 +23,98 @@ namespace lar_content
 class DeltaRayMatchingContainers
 {
 public:
+    /**
+     *  @brief  NearbyClusters class, the clusters near to a given cluster, in the order in which they were found, with constant time look-up
+     */
+    class NearbyClusters
+    {
+    public:
+        typedef pandora::ClusterList::const_iterator const_iterator;
+
+        /**
+         *  @brief  Default constructor
+         */
+        NearbyClusters() = default;
+
+        /**
+         *  @brief  Copy constructor
+         *
+         *  @param  rhs the nearby clusters to copy
+         */
+        NearbyClusters(const NearbyClusters &rhs);
+
+        /**
+         *  @brief  Assignment operator
+         *
+         *  @param  rhs the nearby clusters to assign
+         */
+        NearbyClusters &operator=(const NearbyClusters &rhs);
+
+        /**
+         *  @brief  Whether a given cluster is present
+         *
+         *  @param  pCluster the address of the cluster
+         *
+         *  @return boolean
+         */
+        bool Contains(const pandora::Cluster *const pCluster) const;
+
+        /**
+         *  @brief  Add a cluster, after those already present
+         *
+         *  @param  pCluster the address of the cluster
+         *
+         *  @return whether the cluster was added, i.e. was not already present
+         */
+        bool Insert(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Remove a cluster, retaining the order of those remaining
+         *
+         *  @param  pCluster the address of the cluster
+         *
+         *  @return whether the cluster was removed, i.e. was present
+         */
+        bool Erase(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Get the number of clusters
+         *
+         *  @return the number of clusters
+         */
+        unsigned int size() const;
+
+        /**
+         *  @brief  Whether there are no clusters
+         *
+         *  @return boolean
+         */
+        bool empty() const;
+
+        /**
+         *  @brief  Get an iterator to the first cluster
+         *
+         *  @return the iterator
+         */
+        const_iterator begin() const;
+
+        /**
+         *  @brief  Get an iterator past the last cluster
+         *
+         *  @return the iterator
+         */
+        const_iterator end() const;
+
+    private:
+        typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterList::iterator> ClusterToIteratorMap;
+
+        pandora::ClusterList m_clusterList;          ///< The clusters, in the order in which they were found
+        ClusterToIteratorMap m_clusterToIteratorMap; ///< The mapping of each cluster to its position in the cluster list
+    };
+
     typedef std::map<const pandora::Cluster *, const pandora::ParticleFlowObject *> ClusterToPfoMap;
-    typedef std::map<const pandora::Cluster *, pandora::ClusterList> ClusterProximityMap;
+    typedef std::map<const pandora::Cluster *, NearbyClusters> ClusterProximityMap;
+    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
 
     /**
      *  @brief  Default constructor
@@ -85,7 +177,6 @@ public:
     float m_searchRegion1D; ///< Search region, applied to each dimension, for look-up from kd-tree
 
 private:
-    typedef std::map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
     typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
     typedef std::vector<HitKDNode2D> HitKDNode2DList;
@@ -119,25 +210,58 @@ private:
     void FillClusterProximityMap(const pandora::ClusterList &inputClusterList);
 
     /**
-     *  @brief  Build the KD tree
+     *  @brief  Build the KD tree from the current contents of the hit to cluster map, discarding any stale or unindexed hit records
      *
      *  @param  hitType the hit type of the KD tree to build
      */
     void BuildKDTree(const pandora::HitType hitType);
 
     /**
-     *  @brief  Add a cluster to the cluster proximity map
+     *  @brief  Rebuild the KD tree if the number of stale and unindexed hits has grown too large, relative to the number of indexed hits
+     *
+     *  @param  hitType the hit type of the KD tree to compact
+     */
+    void CompactKDTree(const pandora::HitType hitType);
+
+    /**
+     *  @brief  Add a cluster to the cluster proximity map, linking it symmetrically to each cluster with a hit within the search region
      *
      *  @param  pCluster the address of the input cluster
      */
     void AddToClusterProximityMap(const pandora::Cluster *const pCluster);
 
+    /**
+     *  @brief  Record that two clusters are near to one another, in the entries of both clusters in the cluster proximity map
+     *
+     *  @param  pCluster1 the address of the first cluster
+     *  @param  pCluster2 the address of the second cluster
+     *  @param  clusterProximityMap the cluster proximity map
+     */
+    void AddProximity(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, ClusterProximityMap &clusterProximityMap) const;
+
+    /**
+     *  @brief  Remove a cluster from the cluster proximity map, both its own entry and its presence in the entries of its nearby clusters
+     *
+     *  @param  pCluster the address of the cluster
+     *  @param  clusterProximityMap the cluster proximity map
+     */
+    void RemoveProximity(const pandora::Cluster *const pCluster, ClusterProximityMap &clusterProximityMap) const;
+
     HitToClusterMap m_hitToClusterMapU;         ///< The mapping of hits to the clusters to which they belong (in the U view)
     HitToClusterMap m_hitToClusterMapV;         ///< The mapping of hits to the clusters to which they belong (in the V view)
     HitToClusterMap m_hitToClusterMapW;         ///< The mapping of hits to the clusters to which they belong (in the W view)
     HitKDTree2D m_kdTreeU;                      ///< The KD tree (in the U view)
     HitKDTree2D m_kdTreeV;                      ///< The KD tree (in the V view)
     HitKDTree2D m_kdTreeW;                      ///< The KD tree (in the W view)
+    pandora::CaloHitSet m_indexedHitsU;         ///< The hits held in the KD tree, including those since removed (in the U view)
+    pandora::CaloHitSet m_indexedHitsV;         ///< The hits held in the KD tree, including those since removed (in the V view)
+    pandora::CaloHitSet m_indexedHitsW;         ///< The hits held in the KD tree, including those since removed (in the W view)
+    pandora::CaloHitVector m_unindexedHitsU;    ///< The hits added since the KD tree was built, searched exhaustively (in the U view)
+    pandora::CaloHitVector m_unindexedHitsV;    ///< The hits added since the KD tree was built, searched exhaustively (in the V view)
+    pandora::CaloHitVector m_unindexedHitsW;    ///< The hits added since the KD tree was built, searched exhaustively (in the W view)
+    unsigned int m_nStaleHitsU;                 ///< The number of KD tree hits absent from the hit to cluster map (in the U view)
+    unsigned int m_nStaleHitsV;                 ///< The number of KD tree hits absent from the hit to cluster map (in the V view)
+    unsigned int m_nStaleHitsW;                 ///< The number of KD tree hits absent from the hit to cluster map (in the W view)
     ClusterProximityMap m_clusterProximityMapU; ///< The mapping of clusters to their neighbouring clusters (in the U view)
     ClusterProximityMap m_clusterProximityMapV; ///< The mapping of clusters to their neighbouring clusters (in the V view)
     ClusterProximityMap m_clusterProximityMapW; ///< The mapping of clusters to their neighbouring clusters (in the W view)
@@ -149,6 +273,42 @@ private:
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline bool DeltaRayMatchingContainers::NearbyClusters::Contains(const pandora::Cluster *const pCluster) const
+{
+    return (m_clusterToIteratorMap.count(pCluster) > 0);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int DeltaRayMatchingContainers::NearbyClusters::size() const
+{
+    return m_clusterList.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool DeltaRayMatchingContainers::NearbyClusters::empty() const
+{
+    return m_clusterList.empty();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline DeltaRayMatchingContainers::NearbyClusters::const_iterator DeltaRayMatchingContainers::NearbyClusters::begin() const
+{
+    return m_clusterList.begin();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline DeltaRayMatchingContainers::NearbyClusters::const_iterator DeltaRayMatchingContainers::NearbyClusters::end() const
+{
+    return m_clusterList.end();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline const DeltaRayMatchingContainers::ClusterProximityMap &DeltaRayMatchingContainers::GetClusterProximityMap(const pandora::HitType hitType) const
 {
     return ((hitType == pandora::TPC_VIEW_U) ? m_clusterProximityMapU : (hitType == pandora::TPC_VIEW_V) ? m_clusterProximityMapV : m_clusterProximityMapW);
@@ -24,6 +24,10 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
 using namespace pandora;
 
 namespace lar_content
@@ -601,20 +605,84 @@ void NViewDeltaRayMatchingAlgorithm<T>::CollectHitsFromMuon(const CartesianVecto
     CaloHitList cosmicRayHitList;
     pMuonCluster->GetOrderedCaloHitList().FillCaloHitList(cosmicRayHitList);
 
-    bool hitsAdded(true);
-    while (hitsAdded)
+    if (cosmicRayHitList.empty())
+        return;
+
+    // ATTN Accretion only ever lowers the distance of a hit to the collected hits, so a rejected hit need only be re-examined once a newly
+    // collected hit lies within maxDistanceToCollected of it. The original passes over the hit list are replayed in order, via frontiers
+    const CaloHitVector cosmicRayHitVector(cosmicRayHitList.begin(), cosmicRayHitList.end());
+    const unsigned int nHits(cosmicRayHitVector.size());
+
+    std::unordered_map<const CaloHit *, unsigned int> hitToIndexMap;
+    std::unordered_set<const CaloHit *> collectedHitSet(collectedHits.begin(), collectedHits.end());
+    FloatVector distancesToCollectedHits, distancesToMuonHits;
+
+    for (unsigned int index = 0; index < nHits; ++index)
     {
-        hitsAdded = false;
+        const CaloHit *const pCaloHit(cosmicRayHitVector.at(index));
+        (void)hitToIndexMap.insert(std::make_pair(pCaloHit, index));
+        distancesToCollectedHits.push_back(LArMuonLeadingHelper::GetClosestDistance(pCaloHit, deltaRayProjectedPositions));
+        distancesToMuonHits.push_back(muonDirection.GetCrossProduct(pCaloHit->GetPositionVector() - positionOnMuon).GetMagnitude());
+    }
+
+    HitKDTree2D kdTree;
+    HitKDNode2DList hitKDNode2DList;
+
+    KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(cosmicRayHitList, hitKDNode2DList));
+    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
 
-        for (const CaloHit *const pCaloHit : cosmicRayHitList)
+    // ATTN Search region is padded, as the kd tree search excludes hits on its region boundaries, e.g. coincident hits for a zero width region
+    const float searchRegion1D(1.01f * maxDistanceToCollected + 0.01f);
+    std::set<unsigned int> currentPassIndices, nextPassIndices;
+
+    const auto updateDistances = [&](const CaloHit *const pCollectedHit, const unsigned int collectedIndex) {
+        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCollectedHit, searchRegion1D, searchRegion1D));
+
+        HitKDNode2DList found;
+        kdTree.search(searchRegionHits, found);
+
+        for (const auto &hit : found)
         {
-            if (std::find(collectedHits.begin(), collectedHits.end(), pCaloHit) != collectedHits.end())
+            if (collectedHitSet.count(hit.data))
                 continue;
 
-            const float distanceToCollectedHits(std::min(LArMuonLeadingHelper::GetClosestDistance(pCaloHit, deltaRayProjectedPositions),
-                collectedHits.empty() ? std::numeric_limits<float>::max()
-                                      : LArClusterHelper::GetClosestDistance(pCaloHit->GetPositionVector(), collectedHits)));
-            const float distanceToMuonHits(muonDirection.GetCrossProduct(pCaloHit->GetPositionVector() - positionOnMuon).GetMagnitude());
+            const unsigned int index(hitToIndexMap.at(hit.data));
+            const float distance((hit.data->GetPositionVector() - pCollectedHit->GetPositionVector()).GetMagnitude());
+
+            if (distance < distancesToCollectedHits.at(index))
+            {
+                distancesToCollectedHits.at(index) = distance;
+                (void)(index > collectedIndex ? currentPassIndices : nextPassIndices).insert(index);
+            }
+        }
+    };
+
+    for (const CaloHit *const pCollectedHit : collectedHits)
+        updateDistances(pCollectedHit, nHits);
+
+    currentPassIndices.clear();
+    nextPassIndices.clear();
+
+    for (unsigned int index = 0; index < nHits; ++index)
+    {
+        if (!collectedHitSet.count(cosmicRayHitVector.at(index)))
+            (void)currentPassIndices.insert(index);
+    }
+
+    while (!currentPassIndices.empty())
+    {
+        while (!currentPassIndices.empty())
+        {
+            const unsigned int index(*currentPassIndices.begin());
+            currentPassIndices.erase(currentPassIndices.begin());
+
+            const CaloHit *const pCaloHit(cosmicRayHitVector.at(index));
+
+            if (collectedHitSet.count(pCaloHit))
+                continue;
+
+            const float distanceToCollectedHits(distancesToCollectedHits.at(index));
+            const float distanceToMuonHits(distancesToMuonHits.at(index));
 
             if ((std::fabs(distanceToMuonHits - distanceToCollectedHits) < std::numeric_limits<float>::epsilon()) ||
                 (distanceToMuonHits < minDistanceFromMuon) || (distanceToCollectedHits > distanceToMuonHits) ||
@@ -624,8 +692,11 @@ void NViewDeltaRayMatchingAlgorithm<T>::CollectHitsFromMuon(const CartesianVecto
             }
 
             collectedHits.push_back(pCaloHit);
-            hitsAdded = true;
+            (void)collectedHitSet.insert(pCaloHit);
+            updateDistances(pCaloHit, index);
         }
+
+        currentPassIndices.swap(nextPassIndices);
     }
 }
 
@@ -667,11 +738,14 @@ StatusCode NViewDeltaRayMatchingAlgorithm<T>::ParameteriseMuon(const ParticleFlo
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
     const TwoDSlidingFitResult slidingFitResult(pMuonCluster, 40, slidingFitPitch);
 
+    HitKDTree2D muonKDTree;
+    LArMuonLeadingHelper::FillKDTree(pMuonCluster, muonKDTree);
+
     CartesianVector deltaRayVertex(0.f, 0.f, 0.f), muonVertex(0.f, 0.f, 0.f);
-    LArMuonLeadingHelper::GetClosestPositions(deltaRayProjectedPositions, pMuonCluster, deltaRayVertex, muonVertex);
+    LArMuonLeadingHelper::GetClosestPositions(deltaRayProjectedPositions, pMuonCluster, muonKDTree, deltaRayVertex, muonVertex);
 
     const StatusCode status(LArMuonLeadingHelper::GetClosestPosition(
-        muonVertex, muonProjectedPositions, pMuonCluster, m_maxDistanceToCluster, m_maxDistanceToReferencePoint, positionOnMuon));
+        muonVertex, muonProjectedPositions, muonKDTree, m_maxDistanceToCluster, m_maxDistanceToReferencePoint, positionOnMuon));
 
     if (status != STATUS_CODE_SUCCESS)
         return STATUS_CODE_NOT_FOUND;
@@ -23,9 +23,9 @@ template <typename T>
 class NViewDeltaRayMatchingAlgorithm : public NViewMatchingAlgorithm<T>
 {
 public:
-    typedef std::map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
-    typedef std::map<const pandora::Cluster *, const pandora::ParticleFlowObject *> ClusterToPfoMap;
-    typedef std::map<const pandora::Cluster *, pandora::ClusterList> ClusterProximityMap;
+    typedef DeltaRayMatchingContainers::HitToClusterMap HitToClusterMap;
+    typedef DeltaRayMatchingContainers::ClusterToPfoMap ClusterToPfoMap;
+    typedef DeltaRayMatchingContainers::ClusterProximityMap ClusterProximityMap;
 
     typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
     typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
@@ -125,7 +125,7 @@ void OneViewDeltaRayMatchingAlgorithm::PerformOneViewMatching(const HitType hitT
             continue;
 
         bool found(false);
-        const ClusterList &nearbyClusters(clusterProximityMap.at(pAvailableCluster));
+        const DeltaRayMatchingContainers::NearbyClusters &nearbyClusters(clusterProximityMap.at(pAvailableCluster));
         PfoVector nearbyMuonPfoVector;
 
         do
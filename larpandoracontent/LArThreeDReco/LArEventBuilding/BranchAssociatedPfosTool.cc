@@ -8,7 +8,6 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
-#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
@@ -38,6 +37,7 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    PfoSet examinedParentPfos;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -54,6 +54,9 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
 
         for (const ParticleFlowObject *const pParentPfo : assignedPfos)
         {
+            if (!this->ShouldExamineParent(pParentPfo, examinedParentPfos))
+                continue;
+
             PfoInfo *const pParentPfoInfo(pfoInfoMap.at(pParentPfo));
             const Cluster *const pParentCluster3D(pParentPfoInfo->GetCluster3D());
 
@@ -64,13 +67,16 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
             const CartesianVector &parentVertexPosition(pParentPfoInfo->IsInnerLayerAssociated() ? parentFitResult.GetGlobalMinLayerPosition()
                                                                                                  : parentFitResult.GetGlobalMaxLayerPosition());
 
+            HitKDTree3D kdTree;
+            bool kdTreeBuilt(false);
+
             for (const ParticleFlowObject *const pPfo : unassignedPfos)
             {
                 if (recentlyAssigned.count(pPfo))
                     continue;
 
                 PfoInfo *const pPfoInfo(pfoInfoMap.at(pPfo));
-                const LArPointingCluster pointingCluster(*(pPfoInfo->GetSlidingFitResult3D()));
+                const LArPointingCluster &pointingCluster(*(pPfoInfo->GetPointingCluster3D()));
 
                 const float dNeutrinoVertex(std::min((pointingCluster.GetInnerVertex().GetPosition() - pNeutrinoVertex->GetPosition()).GetMagnitude(),
                     (pointingCluster.GetOuterVertex().GetPosition() - pNeutrinoVertex->GetPosition()).GetMagnitude()));
@@ -84,8 +90,14 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
                 if (parentIsTrack && (dParentVertex < m_trackBranchAdditionFraction * parentLength3D))
                     continue;
 
-                const float dInnerVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetInnerVertex().GetPosition(), pParentCluster3D));
-                const float dOuterVertex(LArClusterHelper::GetClosestDistance(pointingCluster.GetOuterVertex().GetPosition(), pParentCluster3D));
+                if (!kdTreeBuilt)
+                {
+                    this->BuildKDTree(pParentCluster3D, kdTree);
+                    kdTreeBuilt = true;
+                }
+
+                const float dInnerVertex(this->GetClosestDistance(pointingCluster.GetInnerVertex().GetPosition(), kdTree));
+                const float dOuterVertex(this->GetClosestDistance(pointingCluster.GetOuterVertex().GetPosition(), kdTree));
 
                 if ((dInnerVertex < m_maxParentClusterDistance) || (dOuterVertex < m_maxParentClusterDistance))
                 {
@@ -102,6 +114,33 @@ void BranchAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float BranchAssociatedPfosTool::GetClosestDistance(const CartesianVector &position, HitKDTree3D &kdTree) const
+{
+    HitKDNode3DList found;
+    this->FindNearbyHits(position, m_maxParentClusterDistance, kdTree, found);
+
+    const CaloHit *pClosestCaloHit(nullptr);
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+
+    for (const HitKDNode3D &hit : found)
+    {
+        const float distanceSquared((hit.data->GetPositionVector() - position).GetMagnitudeSquared());
+
+        if (distanceSquared < closestDistanceSquared)
+        {
+            closestDistanceSquared = distanceSquared;
+            pClosestCaloHit = hit.data;
+        }
+    }
+
+    if (!pClosestCaloHit)
+        return std::numeric_limits<float>::max();
+
+    return (position - pClosestCaloHit->GetPositionVector()).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BranchAssociatedPfosTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
@@ -28,6 +28,17 @@ public:
         NeutrinoHierarchyAlgorithm::PfoInfoMap &pfoInfoMap);
 
 private:
+    /**
+     *  @brief  Get the closest distance between a position and the hits in a kd tree, considering only those hits within the max parent
+     *          cluster distance
+     *
+     *  @param  position the position
+     *  @param  kdTree the kd tree
+     *
+     *  @return the closest distance, or the maximum float value if there are no hits within the max parent cluster distance
+     */
+    float GetClosestDistance(const pandora::CartesianVector &position, HitKDTree3D &kdTree) const;
+
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     float m_minNeutrinoVertexDistance;   ///< Branch association: min distance from branch vertex to neutrino vertex
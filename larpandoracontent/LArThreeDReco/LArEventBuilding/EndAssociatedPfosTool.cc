@@ -40,6 +40,7 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
         std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
+    PfoSet examinedParentPfos;
     bool associationsMade(true);
 
     while (associationsMade)
@@ -56,8 +57,11 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
 
         for (const ParticleFlowObject *const pParentPfo : assignedPfos)
         {
+            if (!this->ShouldExamineParent(pParentPfo, examinedParentPfos))
+                continue;
+
             PfoInfo *const pParentPfoInfo(pfoInfoMap.at(pParentPfo));
-            const LArPointingCluster parentPointingCluster(*(pParentPfoInfo->GetSlidingFitResult3D()));
+            const LArPointingCluster &parentPointingCluster(*(pParentPfoInfo->GetPointingCluster3D()));
 
             const LArPointingCluster::Vertex &parentEndpoint(
                 pParentPfoInfo->IsInnerLayerAssociated() ? parentPointingCluster.GetOuterVertex() : parentPointingCluster.GetInnerVertex());
@@ -66,6 +70,10 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
             if (neutrinoVertexDistance < m_minNeutrinoVertexDistance)
                 continue;
 
+            HitKDTree3D kdTree;
+            HitToIndexMap hitToIndexMap;
+            this->BuildParentKDTree(pParentPfoInfo->GetCluster3D(), kdTree, hitToIndexMap);
+
             for (const ParticleFlowObject *const pPfo : unassignedPfos)
             {
                 if (recentlyAssigned.count(pPfo))
@@ -73,7 +81,7 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
 
                 PfoInfo *const pPfoInfo(pfoInfoMap.at(pPfo));
 
-                const LArPointingCluster pointingCluster(*(pPfoInfo->GetSlidingFitResult3D()));
+                const LArPointingCluster &pointingCluster(*(pPfoInfo->GetPointingCluster3D()));
                 const bool useInner((pointingCluster.GetInnerVertex().GetPosition() - parentEndpoint.GetPosition()).GetMagnitudeSquared() <
                                     (pointingCluster.GetOuterVertex().GetPosition() - parentEndpoint.GetPosition()).GetMagnitudeSquared());
 
@@ -85,7 +93,7 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
                         m_maxVertexLongitudinalDistance, m_maxVertexTransverseDistance, m_vertexAngularAllowance) ||
                     LArPointingClusterHelper::IsEmission(daughterVertex.GetPosition(), parentEndpoint, m_minVertexLongitudinalDistance,
                         m_maxVertexLongitudinalDistance, m_maxVertexTransverseDistance, m_vertexAngularAllowance) ||
-                    this->IsCloseToParentEndpoint(parentEndpoint.GetPosition(), pParentPfoInfo->GetCluster3D(), pPfoInfo->GetCluster3D()))
+                    this->IsCloseToParentEndpoint(parentEndpoint.GetPosition(), kdTree, hitToIndexMap, pPfoInfo->GetCluster3D()))
                 {
                     associationsMade = true;
                     pParentPfoInfo->AddDaughterPfo(pPfoInfo->GetThisPfo());
@@ -100,23 +108,63 @@ void EndAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgorit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EndAssociatedPfosTool::BuildParentKDTree(const Cluster *const pParentCluster3D, HitKDTree3D &kdTree, HitToIndexMap &hitToIndexMap) const
+{
+    this->BuildKDTree(pParentCluster3D, kdTree);
+
+    CaloHitList caloHitList;
+    pParentCluster3D->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    unsigned int index(0);
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+        hitToIndexMap[pCaloHit] = index++;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool EndAssociatedPfosTool::IsCloseToParentEndpoint(
-    const CartesianVector &parentEndpoint, const Cluster *const pParentCluster3D, const Cluster *const pDaughterCluster3D) const
+    const CartesianVector &parentEndpoint, HitKDTree3D &kdTree, const HitToIndexMap &hitToIndexMap, const Cluster *const pDaughterCluster3D) const
 {
-    try
-    {
-        CartesianVector parentPosition3D(0.f, 0.f, 0.f), daughterPosition3D(0.f, 0.f, 0.f);
-        LArClusterHelper::GetClosestPositions(pParentCluster3D, pDaughterCluster3D, parentPosition3D, daughterPosition3D);
+    CaloHitList daughterCaloHitList;
+    pDaughterCluster3D->GetOrderedCaloHitList().FillCaloHitList(daughterCaloHitList);
 
-        if (((parentPosition3D - parentEndpoint).GetMagnitude() < m_maxParentEndpointDistance) &&
-            ((parentPosition3D - daughterPosition3D).GetMagnitude() < m_maxParentEndpointDistance))
-            return true;
-    }
-    catch (const StatusCodeException &)
+    // ATTN The closest pair of parent and daughter hits need only be found if separated by less than the max parent endpoint distance.
+    // Ties are resolved as for a loop over parent hits then daughter hits, in cluster hit ordering.
+    const CaloHit *pClosestParentHit(nullptr), *pClosestDaughterHit(nullptr);
+    unsigned int closestParentIndex(0);
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+
+    for (const CaloHit *const pDaughterCaloHit : daughterCaloHitList)
     {
+        const CartesianVector &daughterPosition(pDaughterCaloHit->GetPositionVector());
+
+        HitKDNode3DList found;
+        this->FindNearbyHits(daughterPosition, m_maxParentEndpointDistance, kdTree, found);
+
+        for (const HitKDNode3D &hit : found)
+        {
+            const float distanceSquared((hit.data->GetPositionVector() - daughterPosition).GetMagnitudeSquared());
+            const unsigned int parentIndex(hitToIndexMap.at(hit.data));
+
+            if ((distanceSquared < closestDistanceSquared) || ((distanceSquared == closestDistanceSquared) && (parentIndex < closestParentIndex)))
+            {
+                closestDistanceSquared = distanceSquared;
+                closestParentIndex = parentIndex;
+                pClosestParentHit = hit.data;
+                pClosestDaughterHit = pDaughterCaloHit;
+            }
+        }
     }
 
-    return false;
+    if (!pClosestParentHit)
+        return false;
+
+    const CartesianVector &parentPosition3D(pClosestParentHit->GetPositionVector());
+    const CartesianVector &daughterPosition3D(pClosestDaughterHit->GetPositionVector());
+
+    return (((parentPosition3D - parentEndpoint).GetMagnitude() < m_maxParentEndpointDistance) &&
+        ((parentPosition3D - daughterPosition3D).GetMagnitude() < m_maxParentEndpointDistance));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -8,10 +8,10 @@
 #ifndef LAR_END_ASSOCIATED_PFOS_TOOL_H
 #define LAR_END_ASSOCIATED_PFOS_TOOL_H 1
 
-#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
-
 #include "larpandoracontent/LArThreeDReco/LArEventBuilding/NeutrinoHierarchyAlgorithm.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -30,16 +30,28 @@ public:
         NeutrinoHierarchyAlgorithm::PfoInfoMap &pfoInfoMap);
 
 private:
+    typedef std::unordered_map<const pandora::CaloHit *, unsigned int> HitToIndexMap;
+
+    /**
+     *  @brief  Build a kd tree holding the hits in a parent 3D cluster, and record the position of each hit in the cluster hit ordering
+     *
+     *  @param  pParentCluster3D the address of the parent 3D cluster
+     *  @param  kdTree to receive the kd tree
+     *  @param  hitToIndexMap to receive the mapping from parent hits to their positions in the cluster hit ordering
+     */
+    void BuildParentKDTree(const pandora::Cluster *const pParentCluster3D, HitKDTree3D &kdTree, HitToIndexMap &hitToIndexMap) const;
+
     /**
      *  @brief  Whether a daughter 3D cluster is in close proximity to the endpoint of a parent 3D cluster
      *
      *  @param  parentEndpoint the parent endpoint position
-     *  @param  pParentCluster3D the address of the parent 3D cluster
+     *  @param  kdTree the kd tree holding the hits in the parent 3D cluster
+     *  @param  hitToIndexMap the mapping from parent hits to their positions in the cluster hit ordering
      *  @param  pDaughterCluster3D the address of the daughter 3D cluster
      *
      *  @return boolean
      */
-    bool IsCloseToParentEndpoint(const pandora::CartesianVector &parentEndpoint, const pandora::Cluster *const pParentCluster3D,
+    bool IsCloseToParentEndpoint(const pandora::CartesianVector &parentEndpoint, HitKDTree3D &kdTree, const HitToIndexMap &hitToIndexMap,
         const pandora::Cluster *const pDaughterCluster3D) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
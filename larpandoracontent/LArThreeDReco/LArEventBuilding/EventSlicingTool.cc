@@ -205,6 +205,15 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
     sortedClusters3D.insert(sortedClusters3D.end(), showerClusters3D.begin(), showerClusters3D.end());
     std::sort(sortedClusters3D.begin(), sortedClusters3D.end(), LArClusterHelper::SortByNHits);
 
+    // Cache hit coordinates once per cluster, for the repeated shower cone containment tests
+    ClusterCoordinateBlockMap coordinateBlockMap;
+
+    if (m_useShowerConeAssociation && !showerConeFitResults.empty())
+    {
+        for (const Cluster *const pCluster3D : sortedClusters3D)
+            (void)coordinateBlockMap.emplace(pCluster3D, ClusterCoordinateBlock(pCluster3D));
+    }
+
     ClusterSet usedClusters;
 
     for (const Cluster *const pCluster3D : sortedClusters3D)
@@ -219,7 +228,8 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
         usedClusters.insert(pCluster3D);
 
         ClusterVector &clusterSlice(clusterSliceList.back());
-        this->CollectAssociatedClusters(pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        this->CollectAssociatedClusters(
+            pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, coordinateBlockMap, clusterSlice, usedClusters);
     }
 }
 
@@ -227,7 +237,7 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
 
 void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterInSlice, const ClusterVector &candidateClusters,
     const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
-    ClusterVector &clusterSlice, ClusterSet &usedClusters) const
+    const ClusterCoordinateBlockMap &coordinateBlockMap, ClusterVector &clusterSlice, ClusterSet &usedClusters) const
 {
     ClusterVector addedClusters;
 
@@ -238,8 +248,9 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
 
         if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults)) ||
             (m_useProximityAssociation && this->PassProximity(pClusterInSlice, pCandidateCluster)) ||
-            (m_useShowerConeAssociation && (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults) ||
-                                               this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults))))
+            (m_useShowerConeAssociation &&
+                (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults, coordinateBlockMap) ||
+                    this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults, coordinateBlockMap))))
         {
             addedClusters.push_back(pCandidateCluster);
             (void)usedClusters.insert(pCandidateCluster);
@@ -249,7 +260,8 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
     clusterSlice.insert(clusterSlice.end(), addedClusters.begin(), addedClusters.end());
 
     for (const Cluster *const pAddedCluster : addedClusters)
-        this->CollectAssociatedClusters(pAddedCluster, candidateClusters, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        this->CollectAssociatedClusters(
+            pAddedCluster, candidateClusters, trackFitResults, showerConeFitResults, coordinateBlockMap, clusterSlice, usedClusters);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -301,8 +313,8 @@ bool EventSlicingTool::PassProximity(const Cluster *const pClusterInSlice, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EventSlicingTool::PassShowerCone(
-    const Cluster *const pConeCluster, const Cluster *const pNearbyCluster, const ThreeDSlidingConeFitResultMap &showerConeFitResults) const
+bool EventSlicingTool::PassShowerCone(const Cluster *const pConeCluster, const Cluster *const pNearbyCluster,
+    const ThreeDSlidingConeFitResultMap &showerConeFitResults, const ClusterCoordinateBlockMap &coordinateBlockMap) const
 {
     ThreeDSlidingConeFitResultMap::const_iterator fitIter = showerConeFitResults.find(pConeCluster);
 
@@ -324,14 +336,19 @@ bool EventSlicingTool::PassShowerCone(
         return false;
     }
 
+    const ClusterCoordinateBlock &coordinateBlock(coordinateBlockMap.at(pNearbyCluster));
+    const FloatVector coneTanHalfAngles{m_coneTanHalfAngle1, m_coneTanHalfAngle2};
+    FloatVector boundedFractions;
+
     for (const SimpleCone &simpleCone : simpleConeList)
     {
         const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+        simpleCone.GetBoundedHitFractions(coordinateBlock, coneLength, coneTanHalfAngles, boundedFractions);
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1) < m_coneBoundedFraction1)
+        if (boundedFractions.at(0) < m_coneBoundedFraction1)
             continue;
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2) < m_coneBoundedFraction2)
+        if (boundedFractions.at(1) < m_coneBoundedFraction2)
             continue;
 
         return true;
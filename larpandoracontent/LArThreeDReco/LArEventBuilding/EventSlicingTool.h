@@ -84,12 +84,13 @@ private:
      *  @param  candidateClusters the list of candidate clusters
      *  @param  trackFitResults the map of sliding fit results for track candidate clusters
      *  @param  showerConeFitResults the map of sliding const fit results for shower candidate clusters
+     *  @param  coordinateBlockMap the map of cached hit coordinates, for the shower cone association
      *  @param  clusterSlice the cluster slice
      *  @param  usedClusters the list of clusters already added to slices
      */
     void CollectAssociatedClusters(const pandora::Cluster *const pClusterInSlice, const pandora::ClusterVector &candidateClusters,
         const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
-        pandora::ClusterVector &clusterSlice, pandora::ClusterSet &usedClusters) const;
+        const ClusterCoordinateBlockMap &coordinateBlockMap, pandora::ClusterVector &clusterSlice, pandora::ClusterSet &usedClusters) const;
 
     /**
      *  @brief  Compare the provided clusters to assess whether they are associated via pointing (checks association "both ways")
@@ -119,11 +120,12 @@ private:
      *  @param  pClusterInSlice address of a cluster already in the slice
      *  @param  pCandidateCluster address of the candidate cluster
      *  @param  showerConeFitResults the map of sliding cone fit results for shower candidate clusters
+     *  @param  coordinateBlockMap the map of cached hit coordinates, for the shower cone association
      *
      *  @return whether an addition to the cluster slice should be made
      */
     bool PassShowerCone(const pandora::Cluster *const pConeCluster, const pandora::Cluster *const pNearbyCluster,
-        const ThreeDSlidingConeFitResultMap &showerConeFitResults) const;
+        const ThreeDSlidingConeFitResultMap &showerConeFitResults, const ClusterCoordinateBlockMap &coordinateBlockMap) const;
 
     /**
      *  @brief  Check closest approach metrics for a pair of pointing clusters
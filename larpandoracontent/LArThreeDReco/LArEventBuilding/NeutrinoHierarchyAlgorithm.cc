@@ -340,6 +340,7 @@ NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const pandora::ParticleFlowObject *
     m_pCluster3D(nullptr),
     m_pVertex3D(nullptr),
     m_pSlidingFitResult3D(nullptr),
+    m_pPointingCluster3D(nullptr),
     m_isNeutrinoVertexAssociated(false),
     m_isInnerLayerAssociated(false),
     m_pParentPfo(nullptr)
@@ -355,6 +356,8 @@ NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const pandora::ParticleFlowObject *
 
     if (m_pSlidingFitResult3D->GetMinLayer() >= m_pSlidingFitResult3D->GetMaxLayer())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    m_pPointingCluster3D = new LArPointingCluster(*m_pSlidingFitResult3D);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -364,16 +367,18 @@ NeutrinoHierarchyAlgorithm::PfoInfo::PfoInfo(const PfoInfo &rhs) :
     m_pCluster3D(rhs.m_pCluster3D),
     m_pVertex3D(rhs.m_pVertex3D),
     m_pSlidingFitResult3D(nullptr),
+    m_pPointingCluster3D(nullptr),
     m_isNeutrinoVertexAssociated(rhs.m_isNeutrinoVertexAssociated),
     m_isInnerLayerAssociated(rhs.m_isInnerLayerAssociated),
     m_pParentPfo(rhs.m_pParentPfo),
     m_daughterPfoList(rhs.m_daughterPfoList)
 {
-    if (!rhs.m_pSlidingFitResult3D)
+    if (!rhs.m_pSlidingFitResult3D || !rhs.m_pPointingCluster3D)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
     m_pSlidingFitResult3D = new ThreeDSlidingFitResult(m_pCluster3D, rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerFitHalfWindow(),
         rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerPitch());
+    m_pPointingCluster3D = new LArPointingCluster(*rhs.m_pPointingCluster3D);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -382,7 +387,7 @@ NeutrinoHierarchyAlgorithm::PfoInfo &NeutrinoHierarchyAlgorithm::PfoInfo::operat
 {
     if (this != &rhs)
     {
-        if (!rhs.m_pSlidingFitResult3D)
+        if (!rhs.m_pSlidingFitResult3D || !rhs.m_pPointingCluster3D)
             throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
         m_pThisPfo = rhs.m_pThisPfo;
@@ -396,6 +401,9 @@ NeutrinoHierarchyAlgorithm::PfoInfo &NeutrinoHierarchyAlgorithm::PfoInfo::operat
         delete m_pSlidingFitResult3D;
         m_pSlidingFitResult3D = new ThreeDSlidingFitResult(m_pCluster3D, rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerFitHalfWindow(),
             rhs.m_pSlidingFitResult3D->GetFirstFitResult().GetLayerPitch());
+
+        delete m_pPointingCluster3D;
+        m_pPointingCluster3D = new LArPointingCluster(*rhs.m_pPointingCluster3D);
     }
 
     return *this;
@@ -406,6 +414,7 @@ NeutrinoHierarchyAlgorithm::PfoInfo &NeutrinoHierarchyAlgorithm::PfoInfo::operat
 NeutrinoHierarchyAlgorithm::PfoInfo::~PfoInfo()
 {
     delete m_pSlidingFitResult3D;
+    delete m_pPointingCluster3D;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -495,4 +504,43 @@ StatusCode NeutrinoHierarchyAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool PfoRelationTool::ShouldExamineParent(const ParticleFlowObject *const pParentPfo, PfoSet &examinedParentPfos) const
+{
+    // ATTN Whether a pfo is associated to a parent depends only upon properties that are fixed once the parent is assigned, so each
+    // parent need only be examined against the unassigned pfos once
+    return examinedParentPfos.insert(pParentPfo).second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoRelationTool::BuildKDTree(const Cluster *const pCluster3D, HitKDTree3D &kdTree) const
+{
+    CaloHitList caloHitList;
+    pCluster3D->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    HitKDNode3DList hitKDNode3DList;
+    const KDTreeCube hitsBoundingRegion3D(fill_and_bound_3d_kd_tree(caloHitList, hitKDNode3DList));
+    kdTree.build(hitKDNode3DList, hitsBoundingRegion3D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PfoRelationTool::FindNearbyHits(const CartesianVector &position, const float distance, HitKDTree3D &kdTree, HitKDNode3DList &found) const
+{
+    // ATTN Search region is padded, as the kd tree search excludes hits on its region boundaries, and then the hits are filtered by distance
+    const float paddedDistance(1.01f * distance + 0.01f);
+
+    HitKDNode3DList candidates;
+    kdTree.search(build_3d_kd_search_region(position, paddedDistance, paddedDistance, paddedDistance), candidates);
+
+    for (const HitKDNode3D &candidate : candidates)
+    {
+        if ((candidate.data->GetPositionVector() - position).GetMagnitude() < distance)
+            found.push_back(candidate);
+    }
+}
+
 } // namespace lar_content
@@ -10,8 +10,11 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -87,6 +90,13 @@ public:
          */
         const ThreeDSlidingFitResult *GetSlidingFitResult3D() const;
 
+        /**
+         *  @brief  Get the address of the three dimensional pointing cluster, built from the three dimensional sliding fit result
+         *
+         *  @return the address of the three dimensional pointing cluster
+         */
+        const LArPointingCluster *GetPointingCluster3D() const;
+
         /**
          *  @brief  Whether the pfo is associated with the neutrino vertex
          *
@@ -160,6 +170,7 @@ public:
         const pandora::Cluster *m_pCluster3D;          ///< The address of the three dimensional cluster
         const pandora::Vertex *m_pVertex3D;            ///< The address of the three dimensional vertex
         ThreeDSlidingFitResult *m_pSlidingFitResult3D; ///< The three dimensional sliding fit result
+        LArPointingCluster *m_pPointingCluster3D;      ///< The three dimensional pointing cluster
 
         bool m_isNeutrinoVertexAssociated; ///< Whether the pfo is associated with the neutrino vertex
         bool m_isInnerLayerAssociated;     ///< If associated, whether association to parent (vtx or pfo) is at sliding fit inner layer
@@ -263,6 +274,39 @@ public:
      */
     virtual void Run(const NeutrinoHierarchyAlgorithm *const pAlgorithm, const pandora::Vertex *const pNeutrinoVertex,
         NeutrinoHierarchyAlgorithm::PfoInfoMap &pfoInfoMap) = 0;
+
+protected:
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 3> HitKDTree3D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 3> HitKDNode3D;
+    typedef std::vector<HitKDNode3D> HitKDNode3DList;
+
+    /**
+     *  @brief  Whether a parent pfo, not examined by an earlier association pass, should be examined against the unassigned pfos
+     *
+     *  @param  pParentPfo the address of the assigned parent pfo
+     *  @param  examinedParentPfos the parent pfos examined by earlier association passes, to receive the parent pfo
+     *
+     *  @return boolean
+     */
+    bool ShouldExamineParent(const pandora::ParticleFlowObject *const pParentPfo, pandora::PfoSet &examinedParentPfos) const;
+
+    /**
+     *  @brief  Build a kd tree holding the hits in a 3D cluster
+     *
+     *  @param  pCluster3D the address of the 3D cluster
+     *  @param  kdTree to receive the kd tree
+     */
+    void BuildKDTree(const pandora::Cluster *const pCluster3D, HitKDTree3D &kdTree) const;
+
+    /**
+     *  @brief  Find the hits in a kd tree that lie closer to a position than a specified distance
+     *
+     *  @param  position the position
+     *  @param  distance the distance
+     *  @param  kdTree the kd tree
+     *  @param  found to receive the hits closer to the position than the specified distance
+     */
+    void FindNearbyHits(const pandora::CartesianVector &position, const float distance, HitKDTree3D &kdTree, HitKDNode3DList &found) const;
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -288,6 +332,13 @@ inline const ThreeDSlidingFitResult *NeutrinoHierarchyAlgorithm::PfoInfo::GetSli
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline const LArPointingCluster *NeutrinoHierarchyAlgorithm::PfoInfo::GetPointingCluster3D() const
+{
+    return m_pPointingCluster3D;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline bool NeutrinoHierarchyAlgorithm::PfoInfo::IsNeutrinoVertexAssociated() const
 {
     return m_isNeutrinoVertexAssociated;
@@ -53,7 +53,7 @@ void VertexAssociatedPfosTool::Run(const NeutrinoHierarchyAlgorithm *const pAlgo
         if (pPfoInfo->IsNeutrinoVertexAssociated() || pPfoInfo->GetParentPfo())
             continue;
 
-        const LArPointingCluster pointingCluster(*(pPfoInfo->GetSlidingFitResult3D()));
+        const LArPointingCluster &pointingCluster(*(pPfoInfo->GetPointingCluster3D()));
         const bool useInner((pointingCluster.GetInnerVertex().GetPosition() - neutrinoVertex).GetMagnitudeSquared() <
                             (pointingCluster.GetOuterVertex().GetPosition() - neutrinoVertex).GetMagnitudeSquared());
 
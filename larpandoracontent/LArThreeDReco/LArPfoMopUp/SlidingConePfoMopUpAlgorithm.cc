@@ -125,7 +125,10 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
     const ClusterToPfoMap &clusterToPfoMap, ClusterMergeMap &clusterMergeMap) const
 {
     VertexAssociationMap vertexAssociationMap;
+    ClusterCoordinateBlockMap coordinateBlockMap;
     const float layerPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
+    const FloatVector coneTanHalfAngles{m_coneTanHalfAngle1, m_coneTanHalfAngle2};
+    FloatVector boundedFractions;
 
     for (const Cluster *const pShowerCluster : clusters3D)
     {
@@ -164,12 +167,12 @@ void SlidingConePfoMopUpAlgorithm::GetClusterMergeMap(const Vertex *const pVerte
                 continue;
 
             ClusterMerge bestClusterMerge(nullptr, 0.f, 0.f);
+            const ClusterCoordinateBlock &coordinateBlock(coordinateBlockMap.try_emplace(pNearbyCluster, pNearbyCluster).first->second);
 
             for (const SimpleCone &simpleCone : simpleConeList)
             {
-                const float boundedFraction1(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1));
-                const float boundedFraction2(simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2));
-                const ClusterMerge clusterMerge(pShowerCluster, boundedFraction1, boundedFraction2);
+                simpleCone.GetBoundedHitFractions(coordinateBlock, coneLength, coneTanHalfAngles, boundedFractions);
+                const ClusterMerge clusterMerge(pShowerCluster, boundedFractions.at(0), boundedFractions.at(1));
 
                 if (clusterMerge < bestClusterMerge)
                     bestClusterMerge = clusterMerge;
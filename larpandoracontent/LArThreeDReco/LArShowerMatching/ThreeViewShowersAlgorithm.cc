@@ -128,6 +128,7 @@ void ThreeViewShowersAlgorithm::PrepareInputClusters(ClusterList &preparedCluste
 void ThreeViewShowersAlgorithm::TidyUp()
 {
     m_slidingFitResultMap.clear();
+    m_xSortedHitsMap.clear();
     return BaseAlgorithm::TidyUp();
 }
 
@@ -140,6 +141,9 @@ void ThreeViewShowersAlgorithm::AddToSlidingFitCache(const Cluster *const pClust
 
     if (!m_slidingFitResultMap.insert(TwoDSlidingShowerFitResultMap::value_type(pCluster, slidingShowerFitResult)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    if (!m_xSortedHitsMap.insert(XSortedHitsMap::value_type(pCluster, XSortedHits(pCluster))).second)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -150,6 +154,8 @@ void ThreeViewShowersAlgorithm::RemoveFromSlidingFitCache(const Cluster *const p
 
     if (m_slidingFitResultMap.end() != iter)
         m_slidingFitResultMap.erase(iter);
+
+    m_xSortedHitsMap.erase(pCluster);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -178,17 +184,20 @@ StatusCode ThreeViewShowersAlgorithm::CalculateOverlapResult(
     if (xSampling.m_xOverlapSpan < std::numeric_limits<float>::epsilon())
         return STATUS_CODE_NOT_FOUND;
 
-    ShowerPositionMapPair positionMapsU, positionMapsV, positionMapsW;
-    this->GetShowerPositionMaps(fitResultU, fitResultV, fitResultW, xSampling, positionMapsU, positionMapsV, positionMapsW);
+    const unsigned int nBins(xSampling.GetNBins());
+    ShowerEdgeArrayPair edgeArraysU(ShowerEdgeArray(0, nBins), ShowerEdgeArray(0, nBins));
+    ShowerEdgeArrayPair edgeArraysV(ShowerEdgeArray(0, nBins), ShowerEdgeArray(0, nBins));
+    ShowerEdgeArrayPair edgeArraysW(ShowerEdgeArray(0, nBins), ShowerEdgeArray(0, nBins));
+    this->GetShowerEdgeArrays(fitResultU, fitResultV, fitResultW, xSampling, edgeArraysU, edgeArraysV, edgeArraysW);
 
     unsigned int nSampledHitsU(0), nMatchedHitsU(0);
-    this->GetBestHitOverlapFraction(pClusterU, xSampling, positionMapsU, nSampledHitsU, nMatchedHitsU);
+    this->GetBestHitOverlapFraction(pClusterU, xSampling, edgeArraysU, nSampledHitsU, nMatchedHitsU);
 
     unsigned int nSampledHitsV(0), nMatchedHitsV(0);
-    this->GetBestHitOverlapFraction(pClusterV, xSampling, positionMapsV, nSampledHitsV, nMatchedHitsV);
+    this->GetBestHitOverlapFraction(pClusterV, xSampling, edgeArraysV, nSampledHitsV, nMatchedHitsV);
 
     unsigned int nSampledHitsW(0), nMatchedHitsW(0);
-    this->GetBestHitOverlapFraction(pClusterW, xSampling, positionMapsW, nSampledHitsW, nMatchedHitsW);
+    this->GetBestHitOverlapFraction(pClusterW, xSampling, edgeArraysW, nSampledHitsW, nMatchedHitsW);
 
     const unsigned int nMatchedHits(nMatchedHitsU + nMatchedHitsV + nMatchedHitsW);
     const unsigned int nSampledHits(nSampledHitsU + nSampledHitsV + nSampledHitsW);
@@ -216,9 +225,9 @@ StatusCode ThreeViewShowersAlgorithm::CalculateOverlapResult(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFitResult &fitResultU,
+void ThreeViewShowersAlgorithm::GetShowerEdgeArrays(const TwoDSlidingShowerFitResult &fitResultU,
     const TwoDSlidingShowerFitResult &fitResultV, const TwoDSlidingShowerFitResult &fitResultW, const XSampling &xSampling,
-    ShowerPositionMapPair &positionMapsU, ShowerPositionMapPair &positionMapsV, ShowerPositionMapPair &positionMapsW) const
+    ShowerEdgeArrayPair &edgeArraysU, ShowerEdgeArrayPair &edgeArraysV, ShowerEdgeArrayPair &edgeArraysW) const
 {
     const unsigned int nPoints(static_cast<unsigned int>(xSampling.m_nPoints));
 
@@ -247,8 +256,8 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
             const float uv2wMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMax, vMax));
             const float uv2wMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMin, vMax));
             const float uv2wMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, uMax, vMin));
-            positionMapsW.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uv2wMinMin, uv2wMaxMax)));
-            positionMapsW.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uv2wMinMax, uv2wMaxMin)));
+            edgeArraysW.first.SetEdges(xBin, uv2wMinMin, uv2wMaxMax);
+            edgeArraysW.second.SetEdges(xBin, uv2wMinMax, uv2wMaxMin);
         }
 
         if ((uValues.size() > 1) && (wValues.size() > 1))
@@ -259,8 +268,8 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
             const float uw2vMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMax, wMax));
             const float uw2vMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMin, wMax));
             const float uw2vMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, uMax, wMin));
-            positionMapsV.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uw2vMinMin, uw2vMaxMax)));
-            positionMapsV.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, uw2vMinMax, uw2vMaxMin)));
+            edgeArraysV.first.SetEdges(xBin, uw2vMinMin, uw2vMaxMax);
+            edgeArraysV.second.SetEdges(xBin, uw2vMinMax, uw2vMaxMin);
         }
 
         if ((vValues.size() > 1) && (wValues.size() > 1))
@@ -271,8 +280,8 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
             const float vw2uMaxMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMax, wMax));
             const float vw2uMinMax(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMin, wMax));
             const float vw2uMaxMin(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, vMax, wMin));
-            positionMapsU.first.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, vw2uMinMin, vw2uMaxMax)));
-            positionMapsU.second.insert(ShowerPositionMap::value_type(xBin, ShowerExtent(x, vw2uMinMax, vw2uMaxMin)));
+            edgeArraysU.first.SetEdges(xBin, vw2uMinMin, vw2uMaxMax);
+            edgeArraysU.second.SetEdges(xBin, vw2uMinMax, vw2uMaxMin);
         }
     }
 }
@@ -280,41 +289,40 @@ void ThreeViewShowersAlgorithm::GetShowerPositionMaps(const TwoDSlidingShowerFit
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ThreeViewShowersAlgorithm::GetBestHitOverlapFraction(const Cluster *const pCluster, const XSampling &xSampling,
-    const ShowerPositionMapPair &positionMaps, unsigned int &nSampledHits, unsigned int &nMatchedHits) const
+    const ShowerEdgeArrayPair &edgeArrays, unsigned int &nSampledHits, unsigned int &nMatchedHits) const
 {
     if ((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    nSampledHits = 0;
-    nMatchedHits = 0;
-    unsigned int nMatchedHits1(0), nMatchedHits2(0);
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    XSortedHitsMap::const_iterator hitsIter = m_xSortedHitsMap.find(pCluster);
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
-    {
-        for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
-        {
-            const CaloHit *const pCaloHit = *hIter;
-            const float x(pCaloHit->GetPositionVector().GetX());
-            const float z(pCaloHit->GetPositionVector().GetZ());
+    if (m_xSortedHitsMap.end() == hitsIter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    const FloatVector &xValues(hitsIter->second.m_x);
+    const FloatVector &zValues(hitsIter->second.m_z);
 
-            int xBin(-1);
-            if (STATUS_CODE_SUCCESS != xSampling.GetBin(x, xBin))
-                continue;
+    // Same acceptance criteria as XSampling::GetBin, which are monotonic in x, so the sampled hits form a contiguous range
+    const FloatVector::const_iterator xBegin(std::partition_point(xValues.begin(), xValues.end(),
+        [&xSampling](const float x) { return ((x - xSampling.m_minX) < -std::numeric_limits<float>::epsilon()); }));
+    const FloatVector::const_iterator xEnd(std::partition_point(
+        xBegin, xValues.end(), [&xSampling](const float x) { return !((x - xSampling.m_maxX) > +std::numeric_limits<float>::epsilon()); }));
 
-            ++nSampledHits;
+    unsigned int nMatchedHits1(0), nMatchedHits2(0);
 
-            ShowerPositionMap::const_iterator positionIter1 = positionMaps.first.find(xBin);
-            ShowerPositionMap::const_iterator positionIter2 = positionMaps.second.find(xBin);
+    for (FloatVector::const_iterator xIter = xBegin; xIter != xEnd; ++xIter)
+    {
+        const float z(zValues[xIter - xValues.begin()]);
+        const int xBin(xSampling.GetBinIndex(*xIter));
 
-            if ((positionMaps.first.end() != positionIter1) && (z > positionIter1->second.GetLowEdgeZ()) && (z < positionIter1->second.GetHighEdgeZ()))
-                ++nMatchedHits1;
+        if (edgeArrays.first.IsContained(xBin, z))
+            ++nMatchedHits1;
 
-            if ((positionMaps.second.end() != positionIter2) && (z > positionIter2->second.GetLowEdgeZ()) && (z < positionIter2->second.GetHighEdgeZ()))
-                ++nMatchedHits2;
-        }
+        if (edgeArrays.second.IsContained(xBin, z))
+            ++nMatchedHits2;
     }
 
+    nSampledHits = static_cast<unsigned int>(xEnd - xBegin);
     nMatchedHits = std::max(nMatchedHits1, nMatchedHits2);
 }
 
@@ -373,10 +381,18 @@ StatusCode ThreeViewShowersAlgorithm::XSampling::GetBin(const float x, int &xBin
     if (((x - m_minX) < -std::numeric_limits<float>::epsilon()) || ((x - m_maxX) > +std::numeric_limits<float>::epsilon()))
         return STATUS_CODE_NOT_FOUND;
 
-    xBin = static_cast<int>(0.5f + m_nPoints * (x - m_minX) / (m_maxX - m_minX));
+    xBin = this->GetBinIndex(x);
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int ThreeViewShowersAlgorithm::XSampling::GetNBins() const
+{
+    // Sampling points lie within [m_minX, m_maxX], so populate bins up to round(m_nPoints), with one spare bin for rounding
+    return static_cast<unsigned int>(m_nPoints + 0.5f) + 2;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -74,6 +74,22 @@ private:
          */
         pandora::StatusCode GetBin(const float x, int &xBin) const;
 
+        /**
+         *  @brief  Convert an x position into a sampling bin, without checking the x position lies within the common x-overlap range
+         *
+         *  @param  x the input x coordinate
+         *
+         *  @return the x bin
+         */
+        int GetBinIndex(const float x) const;
+
+        /**
+         *  @brief  Get the number of sampling bins that can be populated by sampling points in the common x-overlap range
+         *
+         *  @return the number of sampling bins
+         */
+        unsigned int GetNBins() const;
+
         float m_uMinX;        ///< The min x value in the u view
         float m_uMaxX;        ///< The max x value in the u view
         float m_vMinX;        ///< The min x value in the v view
@@ -86,6 +102,10 @@ private:
         float m_nPoints;      ///< The number of sampling points to be used
     };
 
+    typedef std::pair<ShowerEdgeArray, ShowerEdgeArray> ShowerEdgeArrayPair;
+
+    typedef std::unordered_map<const pandora::Cluster *, XSortedHits> XSortedHitsMap;
+
     void TidyUp();
 
     /**
@@ -115,34 +135,32 @@ private:
     pandora::StatusCode CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
         const pandora::Cluster *const pClusterW, ShowerOverlapResult &overlapResult);
 
-    typedef std::pair<ShowerPositionMap, ShowerPositionMap> ShowerPositionMapPair;
-
     /**
-     *  @brief  Get the shower position maps
+     *  @brief  Get the shower edge arrays
      *
      *  @param  fitResultU the sliding shower fit result for the u view
      *  @param  fitResultV the sliding shower fit result for the v view
      *  @param  fitResultW the sliding shower fit result for the w view
      *  @param  xSampling the x sampling details
-     *  @param  positionMapsU to receive the shower position maps for the u view
-     *  @param  positionMapsV to receive the shower position maps for the v view
-     *  @param  positionMapsW to receive the shower position maps for the w view
+     *  @param  edgeArraysU to receive the shower edge arrays for the u view
+     *  @param  edgeArraysV to receive the shower edge arrays for the v view
+     *  @param  edgeArraysW to receive the shower edge arrays for the w view
      */
-    void GetShowerPositionMaps(const TwoDSlidingShowerFitResult &fitResultU, const TwoDSlidingShowerFitResult &fitResultV,
-        const TwoDSlidingShowerFitResult &fitResultW, const XSampling &xSampling, ShowerPositionMapPair &positionMapsU,
-        ShowerPositionMapPair &positionMapsV, ShowerPositionMapPair &positionMapsW) const;
+    void GetShowerEdgeArrays(const TwoDSlidingShowerFitResult &fitResultU, const TwoDSlidingShowerFitResult &fitResultV,
+        const TwoDSlidingShowerFitResult &fitResultW, const XSampling &xSampling, ShowerEdgeArrayPair &edgeArraysU,
+        ShowerEdgeArrayPair &edgeArraysV, ShowerEdgeArrayPair &edgeArraysW) const;
 
     /**
      *  @brief  Get the best fraction of hits, in the common x-overlap range, contained within the provided pair of shower boundaries
      *
      *  @param  pCluster the address of the candidate cluster
      *  @param  xSampling the x sampling details
-     *  @param  positionMaps the shower edge position maps
+     *  @param  edgeArrays the shower edge arrays
      *  @param  nSampledHits to receive the number of hits in the common x-overlap range
      *  @param  nMatchedHits to receive the number of sampled hits contained within the shower edges
      */
     void GetBestHitOverlapFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling,
-        const ShowerPositionMapPair &positionMaps, unsigned int &nSampledHits, unsigned int &nMatchedHits) const;
+        const ShowerEdgeArrayPair &edgeArrays, unsigned int &nSampledHits, unsigned int &nMatchedHits) const;
 
     void ExamineOverlapContainer();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -153,6 +171,7 @@ private:
 
     unsigned int m_slidingFitWindow;                     ///< The layer window for the sliding linear fits
     TwoDSlidingShowerFitResultMap m_slidingFitResultMap; ///< The sliding shower fit result map
+    XSortedHitsMap m_xSortedHitsMap;                     ///< The x-sorted hit coordinates for each cluster in the sliding fit cache
 
     bool m_ignoreUnavailableClusters;  ///< Whether to ignore (skip-over) unavailable clusters
     unsigned int m_minClusterCaloHits; ///< The min number of hits in base cluster selection method
@@ -185,6 +204,13 @@ public:
     virtual bool Run(ThreeViewShowersAlgorithm *const pAlgorithm, TensorType &overlapTensor) = 0;
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline int ThreeViewShowersAlgorithm::XSampling::GetBinIndex(const float x) const
+{
+    return static_cast<int>(0.5f + m_nPoints * (x - m_minX) / (m_maxX - m_minX));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_THREE_VIEW_SHOWERS_ALGORITHM_H
@@ -12,6 +12,10 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterGrowingAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <set>
+
 using namespace pandora;
 
 namespace lar_content
@@ -49,6 +53,9 @@ StatusCode ClusterGrowingAlgorithm::Run()
     this->GetListOfCleanClusters(pClusterList, inputClusters);
     this->GetListOfSeedClusters(inputClusters, seedClusters);
 
+    // ATTN Non-seed clusters are never modified, so a non-seed cluster left unmerged can only be merged later into a seed cluster that grew
+    ClusterSet changedSeedClusters(seedClusters.begin(), seedClusters.end()), assessedClusters;
+
     while (true)
     {
         ClusterVector currentClusters, nonSeedClusters;
@@ -56,11 +63,16 @@ StatusCode ClusterGrowingAlgorithm::Run()
         this->GetListOfNonSeedClusters(currentClusters, seedClusters, nonSeedClusters);
 
         ClusterMergeMap clusterMergeMap;
-        this->PopulateClusterMergeMap(seedClusters, nonSeedClusters, clusterMergeMap);
+        this->PopulateClusterMergeMap(seedClusters, changedSeedClusters, assessedClusters, nonSeedClusters, clusterMergeMap);
 
         if (clusterMergeMap.empty())
             break;
 
+        changedSeedClusters.clear();
+        for (const auto &mapEntry : clusterMergeMap)
+            (void)changedSeedClusters.insert(mapEntry.first);
+
+        assessedClusters = ClusterSet(nonSeedClusters.begin(), nonSeedClusters.end());
         this->MergeClusters(clusterMergeMap);
     }
 
@@ -72,11 +84,13 @@ StatusCode ClusterGrowingAlgorithm::Run()
 void ClusterGrowingAlgorithm::GetListOfNonSeedClusters(
     const ClusterVector &inputClusters, const ClusterVector &seedClusters, ClusterVector &nonSeedClusters) const
 {
+    const ClusterSet seedClusterSet(seedClusters.begin(), seedClusters.end());
+
     for (ClusterVector::const_iterator iter = inputClusters.begin(), iterEnd = inputClusters.end(); iter != iterEnd; ++iter)
     {
         const Cluster *const pCluster = *iter;
 
-        if (seedClusters.end() != std::find(seedClusters.begin(), seedClusters.end(), pCluster))
+        if (seedClusterSet.count(pCluster))
             continue;
 
         nonSeedClusters.push_back(pCluster);
@@ -87,19 +101,77 @@ void ClusterGrowingAlgorithm::GetListOfNonSeedClusters(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ClusterGrowingAlgorithm::PopulateClusterMergeMap(
-    const ClusterVector &seedClusters, const ClusterVector &nonSeedClusters, ClusterMergeMap &clusterMergeMap) const
+void ClusterGrowingAlgorithm::PopulateClusterMergeMap(const ClusterVector &seedClusters, const ClusterSet &changedSeedClusters,
+    const ClusterSet &assessedClusters, const ClusterVector &nonSeedClusters, ClusterMergeMap &clusterMergeMap) const
 {
+    // Index the hits of the changed seed clusters, recording the first position of their seed cluster in the seed cluster vector
+    CaloHitList changedSeedHits;
+    HitToSeedIndexMap hitToSeedIndexMap;
+    std::vector<unsigned int> unchangedSeedIndices;
+
+    for (unsigned int seedIndex = 0; seedIndex < seedClusters.size(); ++seedIndex)
+    {
+        const Cluster *const pSeedCluster(seedClusters.at(seedIndex));
+
+        if (!changedSeedClusters.count(pSeedCluster))
+        {
+            unchangedSeedIndices.push_back(seedIndex);
+            continue;
+        }
+
+        CaloHitList caloHitList;
+        pSeedCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+        for (const CaloHit *const pCaloHit : caloHitList)
+        {
+            if (hitToSeedIndexMap.insert(HitToSeedIndexMap::value_type(pCaloHit, seedIndex)).second)
+                changedSeedHits.push_back(pCaloHit);
+        }
+    }
+
+    HitKDTree2D kdTree;
+    HitKDNode2DList hitKDNode2DList;
+
+    if (!changedSeedHits.empty())
+    {
+        KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(changedSeedHits, hitKDNode2DList));
+        kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    }
+
+    // ATTN Search region is padded, as the kd tree search excludes hits on its region boundaries
+    const float searchRegion1D(1.01f * m_maxClusterSeparation + 0.01f);
+
     for (ClusterVector::const_iterator nIter = nonSeedClusters.begin(), nIterEnd = nonSeedClusters.end(); nIter != nIterEnd; ++nIter)
     {
         const Cluster *const pNonSeedCluster = *nIter;
 
+        // Only seed clusters with hits near the non-seed cluster, or not yet assessed against it, can lie within the maximum separation
+        std::set<unsigned int> candidateSeedIndices;
+
+        if (!assessedClusters.count(pNonSeedCluster))
+            candidateSeedIndices.insert(unchangedSeedIndices.begin(), unchangedSeedIndices.end());
+
+        if (!changedSeedHits.empty())
+        {
+            CaloHitList nonSeedHits;
+            pNonSeedCluster->GetOrderedCaloHitList().FillCaloHitList(nonSeedHits);
+
+            for (const CaloHit *const pCaloHit : nonSeedHits)
+            {
+                HitKDNode2DList found;
+                kdTree.search(build_2d_kd_search_region(pCaloHit, searchRegion1D, searchRegion1D), found);
+
+                for (const HitKDNode2D &hit : found)
+                    (void)candidateSeedIndices.insert(hitToSeedIndexMap.at(hit.data));
+            }
+        }
+
         const Cluster *pBestSeedCluster(NULL);
         float bestDistance(m_maxClusterSeparation);
 
-        for (ClusterVector::const_iterator sIter = seedClusters.begin(), sIterEnd = seedClusters.end(); sIter != sIterEnd; ++sIter)
+        for (const unsigned int seedIndex : candidateSeedIndices)
         {
-            const Cluster *const pThisSeedCluster = *sIter;
+            const Cluster *const pThisSeedCluster = seedClusters.at(seedIndex);
             const float thisDistance(LArClusterHelper::GetClosestDistance(pNonSeedCluster, pThisSeedCluster));
 
             if (thisDistance < bestDistance)
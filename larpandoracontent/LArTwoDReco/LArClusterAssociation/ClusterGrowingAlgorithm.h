@@ -15,6 +15,13 @@
 namespace lar_content
 {
 
+template <typename, unsigned int>
+class KDTreeLinkerAlgo;
+template <typename, unsigned int>
+class KDTreeNodeInfoT;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  ClusterGrowingAlgorithm class
  */
@@ -63,11 +70,13 @@ private:
      *  @brief Identify a set of cluster merges
      *
      *  @param seedClusters the input vector of seed clusters
+     *  @param changedSeedClusters the input set of seed clusters changed since the previous assessment
+     *  @param assessedClusters the input set of non-seed clusters assessed against all seed clusters in the previous assessment
      *  @param nonSeedClusters the input vector of non-seed clusters
      *  @param clusterMergeMap the output map of cluster merges
      */
-    void PopulateClusterMergeMap(
-        const pandora::ClusterVector &seedClusters, const pandora::ClusterVector &nonSeedClusters, ClusterMergeMap &clusterMergeMap) const;
+    void PopulateClusterMergeMap(const pandora::ClusterVector &seedClusters, const pandora::ClusterSet &changedSeedClusters,
+        const pandora::ClusterSet &assessedClusters, const pandora::ClusterVector &nonSeedClusters, ClusterMergeMap &clusterMergeMap) const;
 
     /**
      *  @brief Merge clusters
@@ -76,6 +85,11 @@ private:
      */
     void MergeClusters(const ClusterMergeMap &clusterMergeMap) const;
 
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 2> HitKDTree2D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 2> HitKDNode2D;
+    typedef std::vector<HitKDNode2D> HitKDNode2DList;
+    typedef std::unordered_map<const pandora::CaloHit *, unsigned int> HitToSeedIndexMap;
+
     std::string m_inputClusterListName; ///< The name of the input cluster list. If not specified, will access current list.
 
     float m_maxClusterSeparation; ///< Maximum distance at which clusters can be joined
@@ -39,6 +39,8 @@ void HitWidthClusterMergingAlgorithm::GetListOfCleanClusters(const ClusterList *
     if (!m_clusterToParametersMap.empty())
         m_clusterToParametersMap.clear();
 
+    m_clusterToHigherXExtremaMap.clear();
+
     for (const Cluster *const pCluster : *pClusterList)
     {
         // the original cluster weight, with no hit scaling or hit padding
@@ -101,14 +103,8 @@ void HitWidthClusterMergingAlgorithm::PopulateClusterAssociationMap(const Cluste
 
 bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, const Cluster *const pCurrentCluster, const Cluster *const pTestCluster) const
 {
-    //ATTN - cannot use map since higherXExtrema may have changed during merging
-    const LArHitWidthHelper::ConstituentHitVector currentConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pCurrentCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const LArHitWidthHelper::ConstituentHitVector testConstituentHitVector(
-        LArHitWidthHelper::GetConstituentHits(pTestCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false));
-    const CartesianVector currentHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(currentConstituentHitVector));
-    const CartesianVector testHigherXExtrema(LArHitWidthHelper::GetExtremalCoordinatesHigherX(testConstituentHitVector));
-    float currentMaxX(currentHigherXExtrema.GetX()), testMaxX(testHigherXExtrema.GetX());
+    //ATTN - cannot use parameters map blindly since higherXExtrema may have changed during merging
+    const float currentMaxX(this->GetHigherXExtremaX(pCurrentCluster)), testMaxX(this->GetHigherXExtremaX(pTestCluster));
 
     if (isForward)
     {
@@ -126,6 +122,39 @@ bool HitWidthClusterMergingAlgorithm::IsExtremalCluster(const bool isForward, co
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float HitWidthClusterMergingAlgorithm::GetHigherXExtremaX(const Cluster *const pCluster) const
+{
+    const unsigned int nCaloHits(pCluster->GetNCaloHits());
+    const ClusterToExtremaMap::const_iterator extremaIter(m_clusterToHigherXExtremaMap.find(pCluster));
+
+    if ((m_clusterToHigherXExtremaMap.end() != extremaIter) && (nCaloHits == extremaIter->second.first))
+        return extremaIter->second.second;
+
+    float higherXExtremaX(0.f);
+    const LArHitWidthHelper::ClusterToParametersMap::const_iterator parametersIter(m_clusterToParametersMap.find(pCluster));
+
+    if ((m_clusterToParametersMap.end() != parametersIter) && (nCaloHits == parametersIter->second.GetNumCaloHits()))
+    {
+        higherXExtremaX = parametersIter->second.GetHigherXExtrema().GetX();
+    }
+    else
+    {
+        m_constituentHitPositionBuffer.clear();
+        LArHitWidthHelper::GetConstituentHitPositions(
+            pCluster, m_maxConstituentHitWidth, m_hitWidthScalingFactor, false, m_constituentHitPositionBuffer);
+
+        CartesianVector lowerXExtrema(0.f, 0.f, 0.f), higherXExtrema(0.f, 0.f, 0.f);
+        LArHitWidthHelper::GetExtremalCoordinatesX(m_constituentHitPositionBuffer, lowerXExtrema, higherXExtrema);
+        higherXExtremaX = higherXExtrema.GetX();
+    }
+
+    m_clusterToHigherXExtremaMap[pCluster] = HitCountExtremaPair(nCaloHits, higherXExtremaX);
+
+    return higherXExtremaX;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool HitWidthClusterMergingAlgorithm::AreClustersAssociated(
     const LArHitWidthHelper::ClusterParameters &currentFitParameters, const LArHitWidthHelper::ClusterParameters &testFitParameters) const
 {
@@ -14,6 +14,8 @@
 
 #include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
 
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -33,6 +35,16 @@ private:
     void PopulateClusterAssociationMap(const pandora::ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const;
     bool IsExtremalCluster(const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const;
 
+    /**
+     *  @brief  Get the x coordinate of the higher x extremal point of the constituent hits of a cluster, reusing the stored values for any
+     *          cluster that has not been enlarged by merging since they were calculated
+     *
+     *  @param  pCluster the address of the cluster
+     *
+     *  @return the x coordinate of the higher x extremal point
+     */
+    float GetHigherXExtremaX(const pandora::Cluster *const pCluster) const;
+
     /**
      *  @brief  Determine whether two clusters are associated
      *
@@ -140,6 +152,13 @@ private:
 
     // ATTN Dangling pointers emerge during cluster merging, here explicitly not dereferenced
     mutable LArHitWidthHelper::ClusterToParametersMap m_clusterToParametersMap; ///< The map [cluster -> cluster parameters]
+
+    typedef std::pair<unsigned int, float> HitCountExtremaPair;
+    typedef std::unordered_map<const pandora::Cluster *, HitCountExtremaPair> ClusterToExtremaMap;
+
+    // ATTN Merging only ever adds hits to a cluster, so an unchanged number of calo hits identifies an up-to-date entry
+    mutable ClusterToExtremaMap m_clusterToHigherXExtremaMap;            ///< The map [cluster -> (n calo hits, higher x extremal x coordinate)]
+    mutable pandora::CartesianPointVector m_constituentHitPositionBuffer; ///< Reused buffer of constituent hit positions
 };
 
 } //namespace lar_content
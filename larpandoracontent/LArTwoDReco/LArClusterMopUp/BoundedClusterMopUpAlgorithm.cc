@@ -38,6 +38,32 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    // Cache the remnant hit coordinates once, and index the remnants by x extent, so that each shower visits only overlapping remnants
+    XSortedHitsVector xSortedRemnants;
+    xSortedRemnants.reserve(sortedRemnantClusters.size());
+    IndexVector remnantIndicesByMinX, emptyRemnantIndices;
+
+    for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+    {
+        const unsigned int remnantIndex(xSortedRemnants.size());
+        xSortedRemnants.emplace_back(pRemnantCluster);
+
+        if (xSortedRemnants.back().m_x.empty())
+        {
+            emptyRemnantIndices.push_back(remnantIndex);
+        }
+        else
+        {
+            remnantIndicesByMinX.push_back(remnantIndex);
+        }
+    }
+
+    std::stable_sort(remnantIndicesByMinX.begin(), remnantIndicesByMinX.end(), [&xSortedRemnants](const unsigned int lhs, const unsigned int rhs) {
+        return (xSortedRemnants[lhs].m_x.front() < xSortedRemnants[rhs].m_x.front());
+    });
+
+    IndexVector candidateIndices;
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         CaloHitList clusterHitList;
@@ -51,14 +77,19 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
             ShowerPositionMap showerPositionMap;
             const XSampling xSampling(fitResult.GetShowerFitResult());
             this->GetShowerPositionMap(fitResult, xSampling, showerPositionMap);
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            const ShowerEdgeArray showerEdgeArray(showerPositionMap);
+
+            this->GetCandidateRemnants(xSortedRemnants, remnantIndicesByMinX, emptyRemnantIndices, xSampling, candidateIndices);
+
+            for (const unsigned int remnantIndex : candidateIndices)
             {
-                const float boundedFraction(this->GetBoundedFraction(pRemnantCluster, xSampling, showerPositionMap));
+                const XSortedHits &xSortedHits(xSortedRemnants[remnantIndex]);
+                const float boundedFraction(this->GetBoundedFraction(xSortedHits, xSampling, showerEdgeArray));
 
                 if (boundedFraction < m_minBoundedFraction)
                     continue;
 
-                AssociationDetails &associationDetails(clusterAssociationMap[pRemnantCluster]);
+                AssociationDetails &associationDetails(clusterAssociationMap[xSortedHits.m_pCluster]);
 
                 if (!associationDetails.insert(AssociationDetails::value_type(pPfoCluster, boundedFraction)).second)
                     throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
@@ -76,6 +107,38 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void BoundedClusterMopUpAlgorithm::GetCandidateRemnants(const XSortedHitsVector &xSortedRemnants, const IndexVector &remnantIndicesByMinX,
+    const IndexVector &emptyRemnantIndices, const XSampling &xSampling, IndexVector &candidateIndices) const
+{
+    candidateIndices.clear();
+
+    // A remnant outside the sampled x range has a bounded fraction of zero, so can only be skipped if that fraction would be rejected
+    if (!(0.f < m_minBoundedFraction))
+    {
+        for (unsigned int remnantIndex = 0; remnantIndex < xSortedRemnants.size(); ++remnantIndex)
+            candidateIndices.push_back(remnantIndex);
+
+        return;
+    }
+
+    // Use the x sampling bin range test, which is monotonic in x, so that no remnant with a hit inside the range is skipped
+    const float epsilon(std::numeric_limits<float>::epsilon());
+    const IndexVector::const_iterator lastIter(std::partition_point(remnantIndicesByMinX.begin(), remnantIndicesByMinX.end(),
+        [&](const unsigned int remnantIndex) { return !((xSortedRemnants[remnantIndex].m_x.front() - xSampling.m_maxX) > +epsilon); }));
+
+    for (IndexVector::const_iterator iter = remnantIndicesByMinX.begin(); iter != lastIter; ++iter)
+    {
+        if (!((xSortedRemnants[*iter].m_x.back() - xSampling.m_minX) < -epsilon))
+            candidateIndices.push_back(*iter);
+    }
+
+    // Preserve the original remnant visiting order
+    candidateIndices.insert(candidateIndices.end(), emptyRemnantIndices.begin(), emptyRemnantIndices.end());
+    std::sort(candidateIndices.begin(), candidateIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
     const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const
 {
@@ -105,40 +168,31 @@ void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float BoundedClusterMopUpAlgorithm::GetBoundedFraction(
-    const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
+    const XSortedHits &xSortedHits, const XSampling &xSampling, const ShowerEdgeArray &showerEdgeArray) const
 {
-    if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) || (0 == pCluster->GetNCaloHits()))
+    if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) || xSortedHits.m_x.empty())
     {
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
+    // Only hits passing the x sampling bin range test can be bounded; as the test is monotonic in x, these form a contiguous block
+    const float epsilon(std::numeric_limits<float>::epsilon());
+    const FloatVector::const_iterator beginIter(std::partition_point(
+        xSortedHits.m_x.begin(), xSortedHits.m_x.end(), [&](const float x) { return ((x - xSampling.m_minX) < -epsilon); }));
+    const FloatVector::const_iterator endIter(
+        std::partition_point(beginIter, xSortedHits.m_x.end(), [&](const float x) { return !((x - xSampling.m_maxX) > +epsilon); }));
+
     unsigned int nMatchedHits(0);
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (FloatVector::const_iterator iter = beginIter; iter != endIter; ++iter)
     {
-        for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
-        {
-            const CaloHit *const pCaloHit = *hIter;
-            const float x(pCaloHit->GetPositionVector().GetX());
-            const float z(pCaloHit->GetPositionVector().GetZ());
-
-            try
-            {
-                const int xBin(xSampling.GetBin(x));
-
-                ShowerPositionMap::const_iterator positionIter = showerPositionMap.find(xBin);
+        const float z(xSortedHits.m_z[iter - xSortedHits.m_x.begin()]);
 
-                if ((showerPositionMap.end() != positionIter) && (z > positionIter->second.GetLowEdgeZ()) && (z < positionIter->second.GetHighEdgeZ()))
-                    ++nMatchedHits;
-            }
-            catch (StatusCodeException &)
-            {
-            }
-        }
+        if (showerEdgeArray.IsContained(xSampling.GetBin(*iter), z))
+            ++nMatchedHits;
     }
 
-    return (static_cast<float>(nMatchedHits) / static_cast<float>(pCluster->GetNCaloHits()));
+    return (static_cast<float>(nMatchedHits) / static_cast<float>(xSortedHits.m_x.size()));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
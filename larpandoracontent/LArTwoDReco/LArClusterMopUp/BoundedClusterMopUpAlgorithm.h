@@ -55,8 +55,24 @@ private:
         int m_nPoints; ///< The number of sampling points to be used
     };
 
+    typedef std::vector<XSortedHits> XSortedHitsVector;
+    typedef std::vector<unsigned int> IndexVector;
+
     void ClusterMopUp(const pandora::ClusterList &pfoClusters, const pandora::ClusterList &remnantClusters) const;
 
+    /**
+     *  @brief  Get the indices of the remnant clusters that could have hits bounded by a shower with the specified x sampling, in
+     *          increasing index order. Clusters without hits are always included.
+     *
+     *  @param  xSortedRemnants the x sorted hits of the remnant clusters
+     *  @param  remnantIndicesByMinX the indices of the remnant clusters with hits, ordered by increasing min x
+     *  @param  emptyRemnantIndices the indices of the remnant clusters without hits
+     *  @param  xSampling the x sampling details
+     *  @param  candidateIndices to receive the candidate remnant cluster indices
+     */
+    void GetCandidateRemnants(const XSortedHitsVector &xSortedRemnants, const IndexVector &remnantIndicesByMinX,
+        const IndexVector &emptyRemnantIndices, const XSampling &xSampling, IndexVector &candidateIndices) const;
+
     /**
      *  @brief  Get the shower position map containing high and low edge z positions in bins of x
      *
@@ -67,15 +83,15 @@ private:
     void GetShowerPositionMap(const TwoDSlidingShowerFitResult &fitResult, const XSampling &xSampling, ShowerPositionMap &showerPositionMap) const;
 
     /**
-     *  @brief  Get the fraction of hits in a cluster bounded by a specified shower position map
+     *  @brief  Get the fraction of hits in a cluster bounded by a specified shower edge array
      *
-     *  @param  pCluster address of the cluster
+     *  @param  xSortedHits the x sorted hits of the cluster
      *  @param  xSampling the x sampling details
-     *  @param  showerPositionMap the shower position map
+     *  @param  showerEdgeArray the shower edge array
      *
      *  @return the fraction of bounded hits
      */
-    float GetBoundedFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const;
+    float GetBoundedFraction(const XSortedHits &xSortedHits, const XSampling &xSampling, const ShowerEdgeArray &showerEdgeArray) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
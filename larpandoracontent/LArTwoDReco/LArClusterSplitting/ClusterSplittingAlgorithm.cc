@@ -57,12 +57,14 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
     ClusterList internalClusterList(pClusterList->begin(), pClusterList->end());
     internalClusterList.sort(LArClusterHelper::SortByNHits);
 
+    const std::unique_ptr<SplitContext> pSplitContext(this->CreateSplitContext());
+
     for (ClusterList::iterator iter = internalClusterList.begin(); iter != internalClusterList.end(); ++iter)
     {
         const Cluster *const pCluster = *iter;
         ClusterList clusterSplittingList;
 
-        if (STATUS_CODE_SUCCESS != this->SplitCluster(pCluster, clusterSplittingList))
+        if (STATUS_CODE_SUCCESS != this->SplitCluster(pCluster, *pSplitContext, clusterSplittingList))
             continue;
 
         internalClusterList.splice(internalClusterList.end(), clusterSplittingList);
@@ -74,12 +76,19 @@ StatusCode ClusterSplittingAlgorithm::RunUsingCurrentList() const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster, ClusterList &clusterSplittingList) const
+std::unique_ptr<ClusterSplittingAlgorithm::SplitContext> ClusterSplittingAlgorithm::CreateSplitContext() const
+{
+    return std::make_unique<SplitContext>();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster, SplitContext &splitContext, ClusterList &clusterSplittingList) const
 {
     // Split cluster into two CaloHit lists
     PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
 
-    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, firstParameters.m_caloHitList, secondParameters.m_caloHitList))
+    if (STATUS_CODE_SUCCESS != this->DivideCaloHits(pCluster, splitContext, firstParameters.m_caloHitList, secondParameters.m_caloHitList))
         return STATUS_CODE_NOT_FOUND;
 
     if (firstParameters.m_caloHitList.empty() || secondParameters.m_caloHitList.empty())
@@ -103,11 +112,20 @@ StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster
     // End cluster fragmentation operations
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, clusterListToSaveName, clusterListToDeleteName));
 
+    this->UpdateForClusterSplit(pCluster, pFirstCluster, pSecondCluster, splitContext);
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterSplittingAlgorithm::UpdateForClusterSplit(const Cluster *const /*pSplitCluster*/, const Cluster *const /*pFirstCluster*/,
+    const Cluster *const /*pSecondCluster*/, SplitContext &/*splitContext*/) const
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
@@ -116,4 +134,11 @@ StatusCode ClusterSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ClusterSplittingAlgorithm::SplitContext::~SplitContext()
+{
+}
+
 } // namespace lar_content
@@ -11,6 +11,7 @@
 #include "Pandora/Algorithm.h"
 
 #include <list>
+#include <memory>
 
 namespace lar_content
 {
@@ -24,29 +25,62 @@ protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  SplitContext class, the state carried between the splits made in a single pass over a cluster list
+     */
+    class SplitContext
+    {
+    public:
+        /**
+         *  @brief  Destructor
+         */
+        virtual ~SplitContext();
+    };
+
     /**
      *  @brief  Run the algorithm using the current cluster list as input
      */
     pandora::StatusCode RunUsingCurrentList() const;
 
+    /**
+     *  @brief  Create the context for a single pass over a cluster list
+     *
+     *  @return the split context
+     */
+    virtual std::unique_ptr<SplitContext> CreateSplitContext() const;
+
     /**
      *  @brief  Divide calo hits in a cluster into two lists, each associated with a separate fragment cluster
      *
      *  @param  pCluster address of the cluster
+     *  @param  splitContext the context of the current pass over the cluster list
      *  @param  firstCaloHitList the hits in the first fragment
      *  @param  secondCaloHitList the hits in the second fragment
      */
-    virtual pandora::StatusCode DivideCaloHits(
-        const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList) const = 0;
+    virtual pandora::StatusCode DivideCaloHits(const pandora::Cluster *const pCluster, SplitContext &splitContext,
+        pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList) const = 0;
+
+    /**
+     *  @brief  Receive notification that a cluster has been split, following a successful call to DivideCaloHits
+     *
+     *  @param  pSplitCluster address of the cluster that has been split, now deleted
+     *  @param  pFirstCluster address of the cluster created from the first calo hit list
+     *  @param  pSecondCluster address of the cluster created from the second calo hit list
+     *  @param  splitContext the context of the current pass over the cluster list
+     */
+    virtual void UpdateForClusterSplit(const pandora::Cluster *const pSplitCluster, const pandora::Cluster *const pFirstCluster,
+        const pandora::Cluster *const pSecondCluster, SplitContext &splitContext) const;
 
 private:
     /**
      *  @brief  Split cluster into two fragments
      *
      *  @param  pCluster address of the cluster
+     *  @param  splitContext the context of the current pass over the cluster list
      *  @param  clusterSplittingList to receive the two cluster fragments
      */
-    pandora::StatusCode SplitCluster(const pandora::Cluster *const pCluster, pandora::ClusterList &clusterSplittingList) const;
+    pandora::StatusCode SplitCluster(
+        const pandora::Cluster *const pCluster, SplitContext &splitContext, pandora::ClusterList &clusterSplittingList) const;
 
     pandora::StringVector m_inputClusterListNames; ///< The list of input cluster list names - if empty, use the current cluster list
 };
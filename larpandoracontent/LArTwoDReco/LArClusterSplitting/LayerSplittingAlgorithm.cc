@@ -26,7 +26,8 @@ LayerSplittingAlgorithm::LayerSplittingAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode LayerSplittingAlgorithm::DivideCaloHits(const Cluster *const pCluster, CaloHitList &firstHitList, CaloHitList &secondHitList) const
+StatusCode LayerSplittingAlgorithm::DivideCaloHits(
+    const Cluster *const pCluster, SplitContext &/*splitContext*/, CaloHitList &firstHitList, CaloHitList &secondHitList) const
 {
     unsigned int splitLayer(0);
 
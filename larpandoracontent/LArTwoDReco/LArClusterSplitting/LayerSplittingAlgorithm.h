@@ -26,8 +26,8 @@ public:
 
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
-    pandora::StatusCode DivideCaloHits(
-        const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList) const;
+    pandora::StatusCode DivideCaloHits(const pandora::Cluster *const pCluster, SplitContext &splitContext, pandora::CaloHitList &firstCaloHitList,
+        pandora::CaloHitList &secondCaloHitList) const;
 
     /**
      *  @brief Find the best layer for splitting the cluster
@@ -18,14 +18,39 @@ using namespace pandora;
 namespace lar_content
 {
 
-TwoDSlidingFitSplittingAlgorithm::TwoDSlidingFitSplittingAlgorithm() : m_slidingFitHalfWindow(20), m_minClusterLength(10.f)
+TwoDSlidingFitSplittingAlgorithm::TwoDSlidingFitSplittingAlgorithm() :
+    m_slidingFitHalfWindow(20),
+    m_minClusterLength(10.f),
+    m_deriveFragmentFits(false)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const Cluster *const pCluster, CaloHitList &firstHitList, CaloHitList &secondHitList) const
+std::unique_ptr<ClusterSplittingAlgorithm::SplitContext> TwoDSlidingFitSplittingAlgorithm::CreateSplitContext() const
 {
+    return std::make_unique<FragmentFitContext>();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(
+    const Cluster *const pCluster, SplitContext &splitContext, CaloHitList &firstHitList, CaloHitList &secondHitList) const
+{
+    FragmentFitContext &fragmentFitContext(this->GetFragmentFitContext(splitContext));
+    fragmentFitContext.m_pSplitFitDetails.reset();
+
+    // Claim any sliding fit derived when this cluster was created by an earlier split
+    std::unique_ptr<TwoDSlidingFitResult> pFragmentFitResult;
+    TwoDSlidingFitResultMap &fragmentFitResultMap(fragmentFitContext.m_fragmentFitResultMap);
+    const TwoDSlidingFitResultMap::iterator fragmentFitIter(fragmentFitResultMap.find(pCluster));
+
+    if (fragmentFitResultMap.end() != fragmentFitIter)
+    {
+        pFragmentFitResult = std::make_unique<TwoDSlidingFitResult>(std::move(fragmentFitIter->second));
+        fragmentFitResultMap.erase(fragmentFitIter);
+    }
+
     if (LArClusterHelper::GetLengthSquared(pCluster) < m_minClusterLength * m_minClusterLength)
         return STATUS_CODE_NOT_FOUND;
 
@@ -33,12 +58,13 @@ StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const Cluster *const
     {
         const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
+        const TwoDSlidingFitResult slidingFitResult(
+            pFragmentFitResult ? std::move(*pFragmentFitResult) : TwoDSlidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch));
         CartesianVector splitPosition(0.f, 0.f, 0.f);
 
         if (STATUS_CODE_SUCCESS == this->FindBestSplitPosition(slidingFitResult, splitPosition))
         {
-            return this->DivideCaloHits(slidingFitResult, splitPosition, firstHitList, secondHitList);
+            return this->DivideCaloHits(slidingFitResult, splitPosition, firstHitList, secondHitList, fragmentFitContext.m_pSplitFitDetails);
         }
     }
     catch (StatusCodeException &statusCodeException)
@@ -52,12 +78,15 @@ StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const Cluster *const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const TwoDSlidingFitResult &slidingFitResult,
-    const CartesianVector &splitPosition, CaloHitList &firstCaloHitList, CaloHitList &secondCaloHitList) const
+StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const TwoDSlidingFitResult &slidingFitResult, const CartesianVector &splitPosition,
+    CaloHitList &firstCaloHitList, CaloHitList &secondCaloHitList, std::unique_ptr<SplitFitDetails> &pSplitFitDetails) const
 {
     float rL(0.f), rT(0.f);
     slidingFitResult.GetLocalPosition(splitPosition, rL, rT);
 
+    if (m_deriveFragmentFits && this->CanDeriveFragmentFits(slidingFitResult))
+        pSplitFitDetails = std::make_unique<SplitFitDetails>(slidingFitResult, slidingFitResult.GetLayer(rL));
+
     const Cluster *const pCluster(slidingFitResult.GetCluster());
     const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
 
@@ -78,17 +107,107 @@ StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const TwoDSlidingFit
             {
                 secondCaloHitList.push_back(pCaloHit);
             }
+
+            // Only the layer containing the split position holds hits from both fragments
+            if (pSplitFitDetails && (slidingFitResult.GetLayer(thisL) == pSplitFitDetails->m_splitLayer))
+            {
+                LayerFitContributionMap &boundaryContributionMap(
+                    (thisL < rL) ? pSplitFitDetails->m_firstBoundaryContributionMap : pSplitFitDetails->m_secondBoundaryContributionMap);
+                boundaryContributionMap[pSplitFitDetails->m_splitLayer].AddPoint(thisL, thisT);
+            }
         }
     }
 
     if (firstCaloHitList.empty() || secondCaloHitList.empty())
+    {
+        pSplitFitDetails.reset();
         return STATUS_CODE_NOT_FOUND;
+    }
 
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TwoDSlidingFitSplittingAlgorithm::UpdateForClusterSplit(
+    const Cluster *const pSplitCluster, const Cluster *const pFirstCluster, const Cluster *const pSecondCluster, SplitContext &splitContext) const
+{
+    FragmentFitContext &fragmentFitContext(this->GetFragmentFitContext(splitContext));
+    const std::unique_ptr<SplitFitDetails> pSplitFitDetails(std::move(fragmentFitContext.m_pSplitFitDetails));
+
+    if (!pSplitFitDetails || (pSplitFitDetails->m_parentFitResult.GetCluster() != pSplitCluster))
+        return;
+
+    const TwoDSlidingFitResult &parentFitResult(pSplitFitDetails->m_parentFitResult);
+    const LayerFitContributionMap &parentContributionMap(parentFitResult.GetLayerFitContributionMap());
+    const int splitLayer(pSplitFitDetails->m_splitLayer);
+
+    // The outer end layers of the fragments are unchanged from the parent, unless they coincide with the split layer
+    const int minLayer(std::min(parentContributionMap.begin()->first, splitLayer));
+    const int maxLayer(std::max(parentContributionMap.rbegin()->first, splitLayer));
+
+    LayerFitContributionMap &firstBoundaryContributionMap(pSplitFitDetails->m_firstBoundaryContributionMap);
+    LayerFitContributionMap &secondBoundaryContributionMap(pSplitFitDetails->m_secondBoundaryContributionMap);
+
+    if (minLayer < splitLayer)
+        firstBoundaryContributionMap.insert(*parentContributionMap.begin());
+
+    if (maxLayer > splitLayer)
+        secondBoundaryContributionMap.insert(*parentContributionMap.rbegin());
+
+    // ATTN A fragment fit that cannot be derived is simply calculated from scratch when the fragment is examined
+    try
+    {
+        fragmentFitContext.m_fragmentFitResultMap.emplace(
+            pFirstCluster, TwoDSlidingFitResult(parentFitResult, pFirstCluster, minLayer, splitLayer, firstBoundaryContributionMap));
+    }
+    catch (const StatusCodeException &)
+    {
+    }
+
+    try
+    {
+        fragmentFitContext.m_fragmentFitResultMap.emplace(
+            pSecondCluster, TwoDSlidingFitResult(parentFitResult, pSecondCluster, splitLayer, maxLayer, secondBoundaryContributionMap));
+    }
+    catch (const StatusCodeException &)
+    {
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool TwoDSlidingFitSplittingAlgorithm::CanDeriveFragmentFits(const TwoDSlidingFitResult &slidingFitResult) const
+{
+    // ATTN Matches the default TwoDSlidingFitResult criterion for filling the layer fit contributions with constituent hit positions
+    const CartesianVector xAxis(1.f, 0.f, 0.f);
+    return (std::fabs(xAxis.GetCosOpeningAngle(slidingFitResult.GetAxisDirection())) < 0.95f);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TwoDSlidingFitSplittingAlgorithm::FragmentFitContext &TwoDSlidingFitSplittingAlgorithm::GetFragmentFitContext(SplitContext &splitContext) const
+{
+    FragmentFitContext *const pFragmentFitContext(dynamic_cast<FragmentFitContext *>(&splitContext));
+
+    if (!pFragmentFitContext)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    return *pFragmentFitContext;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+TwoDSlidingFitSplittingAlgorithm::SplitFitDetails::SplitFitDetails(const TwoDSlidingFitResult &parentFitResult, const int splitLayer) :
+    m_parentFitResult(parentFitResult),
+    m_splitLayer(splitLayer)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -97,6 +216,9 @@ StatusCode TwoDSlidingFitSplittingAlgorithm::ReadSettings(const TiXmlHandle xmlH
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinClusterLength", m_minClusterLength));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DeriveFragmentFits", m_deriveFragmentFits));
+
     return ClusterSplittingAlgorithm::ReadSettings(xmlHandle);
 }
 
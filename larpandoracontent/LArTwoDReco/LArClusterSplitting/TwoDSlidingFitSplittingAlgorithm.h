@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/ClusterSplittingAlgorithm.h"
 
+#include <memory>
+
 namespace lar_content
 {
 
@@ -43,8 +45,41 @@ protected:
     float m_minClusterLength;            ///<
 
 private:
-    pandora::StatusCode DivideCaloHits(
-        const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList) const;
+    /**
+     *  @brief  SplitFitDetails class, the information required to derive the sliding fits of the fragments from that of a split cluster
+     */
+    class SplitFitDetails
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  parentFitResult the sliding fit result of the cluster being split
+         *  @param  splitLayer the layer containing the split position
+         */
+        SplitFitDetails(const TwoDSlidingFitResult &parentFitResult, const int splitLayer);
+
+        TwoDSlidingFitResult m_parentFitResult;                 ///< The sliding fit result of the cluster being split
+        int m_splitLayer;                                       ///< The layer containing the split position
+        LayerFitContributionMap m_firstBoundaryContributionMap;  ///< The end layer fit contributions of the first fragment
+        LayerFitContributionMap m_secondBoundaryContributionMap; ///< The end layer fit contributions of the second fragment
+    };
+
+    /**
+     *  @brief  FragmentFitContext class, the details of the latest proposed split and the sliding fits derived for cluster fragments
+     */
+    class FragmentFitContext : public SplitContext
+    {
+    public:
+        std::unique_ptr<SplitFitDetails> m_pSplitFitDetails; ///< The details of the most recently proposed split
+        TwoDSlidingFitResultMap m_fragmentFitResultMap;     ///< The derived sliding fit results of cluster fragments yet to be examined
+    };
+
+    std::unique_ptr<SplitContext> CreateSplitContext() const;
+    pandora::StatusCode DivideCaloHits(const pandora::Cluster *const pCluster, SplitContext &splitContext, pandora::CaloHitList &firstCaloHitList,
+        pandora::CaloHitList &secondCaloHitList) const;
+    void UpdateForClusterSplit(const pandora::Cluster *const pSplitCluster, const pandora::Cluster *const pFirstCluster,
+        const pandora::Cluster *const pSecondCluster, SplitContext &splitContext) const;
 
     /**
      *  @brief  Use sliding linear fit to separate cluster into two fragments
@@ -53,11 +88,33 @@ private:
      *  @param  splitPosition the split position
      *  @param  firstCaloHitList the hits in the first cluster fragment
      *  @param  secondCaloHitList the hits in the second cluster fragment
+     *  @param  pSplitFitDetails to receive the details required to derive the fragment sliding fits, if requested and possible
      *
      *  @return pandora::StatusCode
      */
     pandora::StatusCode DivideCaloHits(const TwoDSlidingFitResult &slidingFitResult, const pandora::CartesianVector &splitPosition,
-        pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList) const;
+        pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList, std::unique_ptr<SplitFitDetails> &pSplitFitDetails) const;
+
+    /**
+     *  @brief  Whether the sliding fits of the fragments of a cluster can be derived from its sliding fit result, which requires the
+     *          layer fit contributions to have been filled using the positions of the cluster calo hits
+     *
+     *  @param  slidingFitResult the sliding fit result of the cluster
+     *
+     *  @return boolean
+     */
+    bool CanDeriveFragmentFits(const TwoDSlidingFitResult &slidingFitResult) const;
+
+    /**
+     *  @brief  Get the fragment fit context of the current pass over the cluster list
+     *
+     *  @param  splitContext the split context
+     *
+     *  @return the fragment fit context
+     */
+    FragmentFitContext &GetFragmentFitContext(SplitContext &splitContext) const;
+
+    bool m_deriveFragmentFits; ///< Whether to derive the sliding fits of cluster fragments from the fit of the split cluster
 };
 
 } // namespace lar_content
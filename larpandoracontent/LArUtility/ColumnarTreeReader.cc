@@ -0,0 +1,214 @@
+/**
+ *  @file   larpandoracontent/LArUtility/ColumnarTreeReader.cc
+ *
+ *  @brief  Implementation of the columnar tree reader class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArUtility/ColumnarTreeReader.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ColumnarTreeReader::ColumnarTreeReader(const std::string &fileName) :
+    m_nRows(0)
+{
+    std::ifstream file(fileName, std::ios::binary | std::ios::in);
+
+    if (!file.is_open())
+    {
+        std::cout << "ColumnarTreeReader: Unable to open file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    char magic[8] = {0};
+    file.read(magic, sizeof(magic));
+
+    if (!file.good() || (0 != std::memcmp(magic, "LARCOLS1", sizeof(magic))))
+    {
+        std::cout << "ColumnarTreeReader: File " << fileName << " is not a columnar tree file" << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    ColumnarTreeReader::ReadString(file, m_treeName);
+
+    uint32_t nColumns(0);
+    ColumnarTreeReader::ReadValue(file, nColumns);
+
+    for (uint32_t iColumn = 0; iColumn < nColumns; ++iColumn)
+    {
+        uint8_t type(0);
+        ColumnarTreeReader::ReadValue(file, type);
+
+        if (type > ColumnarTreeWriter::FLOAT_VECTOR_COLUMN)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        std::string variableName;
+        ColumnarTreeReader::ReadString(file, variableName);
+
+        if (!m_nameToColumnIndexMap.emplace(variableName, m_columns.size()).second)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        m_variableNames.push_back(variableName);
+        m_columns.emplace_back(static_cast<ColumnType>(type));
+    }
+
+    uint32_t nRows(0);
+
+    while (file.read(reinterpret_cast<char *>(&nRows), sizeof(nRows)))
+        this->ReadBlock(file, nRows);
+
+    // ATTN A partial block row count indicates a truncated file
+    if (0 != file.gcount())
+    {
+        std::cout << "ColumnarTreeReader: File " << fileName << " is truncated" << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeReader::GetValue(const std::string &variableName, const unsigned int row, int &value) const
+{
+    value = this->GetColumn(variableName, ColumnarTreeWriter::INT_COLUMN, row).m_intValues.at(row);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeReader::GetValue(const std::string &variableName, const unsigned int row, float &value) const
+{
+    value = this->GetColumn(variableName, ColumnarTreeWriter::FLOAT_COLUMN, row).m_floatValues.at(row);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeReader::GetValue(const std::string &variableName, const unsigned int row, IntVector &values) const
+{
+    const Column &column(this->GetColumn(variableName, ColumnarTreeWriter::INT_VECTOR_COLUMN, row));
+    values.assign(column.m_intValues.begin() + column.m_rowOffsets.at(row), column.m_intValues.begin() + column.m_rowOffsets.at(row + 1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeReader::GetValue(const std::string &variableName, const unsigned int row, FloatVector &values) const
+{
+    const Column &column(this->GetColumn(variableName, ColumnarTreeWriter::FLOAT_VECTOR_COLUMN, row));
+    values.assign(column.m_floatValues.begin() + column.m_rowOffsets.at(row), column.m_floatValues.begin() + column.m_rowOffsets.at(row + 1));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const ColumnarTreeReader::Column &ColumnarTreeReader::GetColumn(const std::string &variableName, const ColumnType type, const unsigned int row) const
+{
+    NameToColumnIndexMap::const_iterator iter(m_nameToColumnIndexMap.find(variableName));
+
+    if (m_nameToColumnIndexMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    const Column &column(m_columns.at(iter->second));
+
+    if (type != column.m_type)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if (row >= m_nRows)
+        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+    return column;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeReader::ReadBlock(std::ifstream &file, const uint32_t nRows)
+{
+    for (Column &column : m_columns)
+    {
+        switch (column.m_type)
+        {
+            case ColumnarTreeWriter::INT_COLUMN:
+                ColumnarTreeReader::ReadValues(file, nRows, column.m_intValues);
+                break;
+            case ColumnarTreeWriter::FLOAT_COLUMN:
+                ColumnarTreeReader::ReadValues(file, nRows, column.m_floatValues);
+                break;
+            case ColumnarTreeWriter::INT_VECTOR_COLUMN:
+                ColumnarTreeReader::ReadValues(file, ColumnarTreeReader::ReadRowOffsets(file, nRows, column.m_rowOffsets), column.m_intValues);
+                break;
+            case ColumnarTreeWriter::FLOAT_VECTOR_COLUMN:
+                ColumnarTreeReader::ReadValues(file, ColumnarTreeReader::ReadRowOffsets(file, nRows, column.m_rowOffsets), column.m_floatValues);
+                break;
+        }
+    }
+
+    m_nRows += nRows;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+uint32_t ColumnarTreeReader::ReadRowOffsets(std::ifstream &file, const uint32_t nRows, std::vector<uint32_t> &rowOffsets)
+{
+    std::vector<uint32_t> sizes;
+    ColumnarTreeReader::ReadValues(file, nRows, sizes);
+
+    if (rowOffsets.empty())
+        rowOffsets.push_back(0);
+
+    uint32_t nValues(0);
+
+    for (const uint32_t size : sizes)
+    {
+        nValues += size;
+        rowOffsets.push_back(rowOffsets.back() + size);
+    }
+
+    return nValues;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ColumnarTreeReader::ReadValue(std::ifstream &file, T &t)
+{
+    if (!file.read(reinterpret_cast<char *>(&t), sizeof(T)))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeReader::ReadString(std::ifstream &file, std::string &string)
+{
+    uint32_t length(0);
+    ColumnarTreeReader::ReadValue(file, length);
+
+    string.resize(length);
+
+    if ((length > 0) && !file.read(&string[0], length))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ColumnarTreeReader::ReadValues(std::ifstream &file, const uint32_t nValues, std::vector<T> &values)
+{
+    const size_t nExistingValues(values.size());
+    values.resize(nExistingValues + nValues);
+
+    if ((nValues > 0) && !file.read(reinterpret_cast<char *>(values.data() + nExistingValues), nValues * sizeof(T)))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarTreeReader::Column::Column(const ColumnType type) :
+    m_type(type)
+{
+}
+
+} // namespace lar_content
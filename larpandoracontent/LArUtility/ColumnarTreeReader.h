@@ -0,0 +1,198 @@
+/**
+ *  @file   larpandoracontent/LArUtility/ColumnarTreeReader.h
+ *
+ *  @brief  Header file for the columnar tree reader class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_COLUMNAR_TREE_READER_H
+#define LAR_COLUMNAR_TREE_READER_H 1
+
+#include "larpandoracontent/LArUtility/ColumnarTreeWriter.h"
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ColumnarTreeReader class, reading the rows of a file written by the ColumnarTreeWriter
+ */
+class ColumnarTreeReader
+{
+public:
+    /**
+     *  @brief  Constructor, reads the full file
+     *
+     *  @param  fileName the name of the input file
+     */
+    ColumnarTreeReader(const std::string &fileName);
+
+    /**
+     *  @brief  Get the tree name
+     *
+     *  @return the tree name
+     */
+    const std::string &GetTreeName() const;
+
+    /**
+     *  @brief  Get the number of rows
+     *
+     *  @return the number of rows
+     */
+    unsigned int GetNRows() const;
+
+    /**
+     *  @brief  Get the variable names, in column order
+     *
+     *  @return the variable names
+     */
+    const pandora::StringVector &GetVariableNames() const;
+
+    /**
+     *  @brief  Get the value of a scalar int variable in a specified row
+     *
+     *  @param  variableName the variable name
+     *  @param  row the row index
+     *  @param  value to receive the value
+     */
+    void GetValue(const std::string &variableName, const unsigned int row, int &value) const;
+
+    /**
+     *  @brief  Get the value of a scalar float variable in a specified row
+     *
+     *  @param  variableName the variable name
+     *  @param  row the row index
+     *  @param  value to receive the value
+     */
+    void GetValue(const std::string &variableName, const unsigned int row, float &value) const;
+
+    /**
+     *  @brief  Get the contents of an int vector variable in a specified row
+     *
+     *  @param  variableName the variable name
+     *  @param  row the row index
+     *  @param  values to receive the contents
+     */
+    void GetValue(const std::string &variableName, const unsigned int row, pandora::IntVector &values) const;
+
+    /**
+     *  @brief  Get the contents of a float vector variable in a specified row
+     *
+     *  @param  variableName the variable name
+     *  @param  row the row index
+     *  @param  values to receive the contents
+     */
+    void GetValue(const std::string &variableName, const unsigned int row, pandora::FloatVector &values) const;
+
+private:
+    typedef ColumnarTreeWriter::ColumnType ColumnType;
+
+    /**
+     *  @brief  Column class
+     */
+    class Column
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  type the column type
+         */
+        Column(const ColumnType type);
+
+        ColumnType m_type;                  ///< The column type
+        pandora::IntVector m_intValues;     ///< The int values, for int and int vector columns
+        pandora::FloatVector m_floatValues; ///< The float values, for float and float vector columns
+        std::vector<uint32_t> m_rowOffsets; ///< The offset of the first value of each row, then the total, for vector columns
+    };
+
+    typedef std::vector<Column> ColumnVector;
+    typedef std::unordered_map<std::string, unsigned int> NameToColumnIndexMap;
+
+    /**
+     *  @brief  Get the column with a specified name, checking its type and the row index
+     *
+     *  @param  variableName the variable name
+     *  @param  type the expected column type
+     *  @param  row the row index
+     *
+     *  @return the column
+     */
+    const Column &GetColumn(const std::string &variableName, const ColumnType type, const unsigned int row) const;
+
+    /**
+     *  @brief  Read a block of rows
+     *
+     *  @param  file the input file, positioned after the block row count
+     *  @param  nRows the number of rows in the block
+     */
+    void ReadBlock(std::ifstream &file, const uint32_t nRows);
+
+    /**
+     *  @brief  Read the per-row sizes of a vector column in a block, extending the row offsets
+     *
+     *  @param  file the input file
+     *  @param  nRows the number of rows in the block
+     *  @param  rowOffsets the row offsets to extend
+     *
+     *  @return the number of values in the block
+     */
+    static uint32_t ReadRowOffsets(std::ifstream &file, const uint32_t nRows, std::vector<uint32_t> &rowOffsets);
+
+    /**
+     *  @brief  Read a value from the file
+     *
+     *  @param  file the input file
+     *  @param  t to receive the value
+     */
+    template <typename T>
+    static void ReadValue(std::ifstream &file, T &t);
+
+    /**
+     *  @brief  Read a string, preceded by its length, from the file
+     *
+     *  @param  file the input file
+     *  @param  string to receive the string
+     */
+    static void ReadString(std::ifstream &file, std::string &string);
+
+    /**
+     *  @brief  Read a contiguous array of values from the file, appending them to a vector
+     *
+     *  @param  file the input file
+     *  @param  nValues the number of values
+     *  @param  values the vector to receive the values
+     */
+    template <typename T>
+    static void ReadValues(std::ifstream &file, const uint32_t nValues, std::vector<T> &values);
+
+    std::string m_treeName;                      ///< The tree name
+    unsigned int m_nRows;                        ///< The number of rows
+    pandora::StringVector m_variableNames;       ///< The variable names, in column order
+    ColumnVector m_columns;                      ///< The columns
+    NameToColumnIndexMap m_nameToColumnIndexMap; ///< The map from variable name to column index
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const std::string &ColumnarTreeReader::GetTreeName() const
+{
+    return m_treeName;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int ColumnarTreeReader::GetNRows() const
+{
+    return m_nRows;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::StringVector &ColumnarTreeReader::GetVariableNames() const
+{
+    return m_variableNames;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_COLUMNAR_TREE_READER_H
@@ -0,0 +1,242 @@
+/**
+ *  @file   larpandoracontent/LArUtility/ColumnarTreeWriter.cc
+ *
+ *  @brief  Implementation of the columnar tree writer class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArUtility/ColumnarTreeWriter.h"
+
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+ColumnarTreeWriter::ColumnarTreeWriter(const std::string &fileName, const std::string &treeName, const unsigned int nRowsPerBlock) :
+    m_file(fileName, std::ios::binary | std::ios::out | std::ios::trunc),
+    m_treeName(treeName),
+    m_nRowsPerBlock(nRowsPerBlock),
+    m_nBufferedRows(0),
+    m_isSchemaFixed(false),
+    m_isHeaderWritten(false)
+{
+    if (0 == m_nRowsPerBlock)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    if (!m_file.is_open())
+    {
+        std::cout << "ColumnarTreeWriter: Unable to open file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarTreeWriter::~ColumnarTreeWriter()
+{
+    if (!m_file.is_open())
+        return;
+
+    try
+    {
+        this->Close();
+    }
+    catch (const StatusCodeException &)
+    {
+        std::cout << "ColumnarTreeWriter: Unable to write buffered rows of tree " << m_treeName << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::SetVariable(const std::string &variableName, const int value)
+{
+    this->GetColumn(variableName, INT_COLUMN).m_intValue = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::SetVariable(const std::string &variableName, const float value)
+{
+    this->GetColumn(variableName, FLOAT_COLUMN).m_floatValue = value;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::SetVariable(const std::string &variableName, const IntVector *const pVector)
+{
+    this->GetColumn(variableName, INT_VECTOR_COLUMN).m_pIntVector = pVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::SetVariable(const std::string &variableName, const FloatVector *const pVector)
+{
+    this->GetColumn(variableName, FLOAT_VECTOR_COLUMN).m_pFloatVector = pVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::Fill()
+{
+    m_isSchemaFixed = true;
+
+    for (Column &column : m_columns)
+    {
+        switch (column.m_type)
+        {
+            case INT_COLUMN:
+                column.m_intValues.push_back(column.m_intValue);
+                break;
+            case FLOAT_COLUMN:
+                column.m_floatValues.push_back(column.m_floatValue);
+                break;
+            case INT_VECTOR_COLUMN:
+                column.m_sizes.push_back(column.m_pIntVector->size());
+                column.m_intValues.insert(column.m_intValues.end(), column.m_pIntVector->begin(), column.m_pIntVector->end());
+                break;
+            case FLOAT_VECTOR_COLUMN:
+                column.m_sizes.push_back(column.m_pFloatVector->size());
+                column.m_floatValues.insert(column.m_floatValues.end(), column.m_pFloatVector->begin(), column.m_pFloatVector->end());
+                break;
+        }
+    }
+
+    if (++m_nBufferedRows >= m_nRowsPerBlock)
+        this->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::Flush()
+{
+    if (0 == m_nBufferedRows)
+        return;
+
+    if (!m_isHeaderWritten)
+        this->WriteHeader();
+
+    const uint32_t nRows(m_nBufferedRows);
+    m_file.write(reinterpret_cast<const char *>(&nRows), sizeof(nRows));
+
+    for (Column &column : m_columns)
+    {
+        this->WriteValues(column.m_sizes);
+        this->WriteValues(column.m_intValues);
+        this->WriteValues(column.m_floatValues);
+        column.m_sizes.clear();
+        column.m_intValues.clear();
+        column.m_floatValues.clear();
+    }
+
+    m_nBufferedRows = 0;
+    m_file.flush();
+
+    if (!m_file.good())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::Close()
+{
+    if (!m_file.is_open())
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
+    this->Flush();
+
+    // ATTN A file with no rows still records the tree name and the schema of any variables set
+    if (!m_isHeaderWritten)
+        this->WriteHeader();
+
+    m_file.close();
+
+    if (m_file.fail())
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarTreeWriter::Column &ColumnarTreeWriter::GetColumn(const std::string &variableName, const ColumnType type)
+{
+    NameToColumnIndexMap::const_iterator iter(m_nameToColumnIndexMap.find(variableName));
+
+    if (m_nameToColumnIndexMap.end() != iter)
+    {
+        Column &column(m_columns.at(iter->second));
+
+        if (type != column.m_type)
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        return column;
+    }
+
+    // ATTN Rows already filled hold no value for a new variable, so the schema cannot grow after the first fill
+    if (m_isSchemaFixed)
+    {
+        std::cout << "ColumnarTreeWriter: Variable " << variableName << " was not set before the first fill of tree " << m_treeName << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+    }
+
+    m_nameToColumnIndexMap.emplace(variableName, m_columns.size());
+    m_columns.emplace_back(variableName, type);
+
+    return m_columns.back();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::WriteHeader()
+{
+    const char magic[8] = {'L', 'A', 'R', 'C', 'O', 'L', 'S', '1'};
+    m_file.write(magic, sizeof(magic));
+    this->WriteString(m_treeName);
+
+    const uint32_t nColumns(m_columns.size());
+    m_file.write(reinterpret_cast<const char *>(&nColumns), sizeof(nColumns));
+
+    for (const Column &column : m_columns)
+    {
+        const uint8_t type(column.m_type);
+        m_file.write(reinterpret_cast<const char *>(&type), sizeof(type));
+        this->WriteString(column.m_name);
+    }
+
+    m_isHeaderWritten = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ColumnarTreeWriter::WriteString(const std::string &string)
+{
+    const uint32_t length(string.size());
+    m_file.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    m_file.write(string.data(), length);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ColumnarTreeWriter::WriteValues(const std::vector<T> &values)
+{
+    if (!values.empty())
+        m_file.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ColumnarTreeWriter::Column::Column(const std::string &name, const ColumnType type) :
+    m_name(name),
+    m_type(type),
+    m_intValue(0),
+    m_floatValue(0.f),
+    m_pIntVector(nullptr),
+    m_pFloatVector(nullptr)
+{
+}
+
+} // namespace lar_content
@@ -0,0 +1,181 @@
+/**
+ *  @file   larpandoracontent/LArUtility/ColumnarTreeWriter.h
+ *
+ *  @brief  Header file for the columnar tree writer class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_COLUMNAR_TREE_WRITER_H
+#define LAR_COLUMNAR_TREE_WRITER_H 1
+
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ColumnarTreeWriter class, a ROOT-free writer of tree-like rows to a fixed-schema binary columnar file
+ *
+ *  The schema is fixed by the variables set before the first fill. Rows are buffered and written in blocks, each holding its columns
+ *  contiguously. The header is written before the first block, or on closing if no rows were filled. All values use the native byte order:
+ *      file   := header block*
+ *      header := "LARCOLS1", uint32 treeNameLength, char treeName[treeNameLength], uint32 nColumns, column-schema[nColumns]
+ *      column-schema := uint8 columnType, uint32 nameLength, char name[nameLength]
+ *      block  := uint32 nRows, column-data[nColumns]
+ *      column-data := value[nRows] for scalar columns, or uint32 size[nRows] then value[sum of sizes] for vector columns
+ *  where columnType is 0 (int32), 1 (float32), 2 (int32 vector) or 3 (float32 vector).
+ */
+class ColumnarTreeWriter
+{
+public:
+    /**
+     *  @brief  ColumnType enum
+     */
+    enum ColumnType : uint8_t
+    {
+        INT_COLUMN = 0,
+        FLOAT_COLUMN = 1,
+        INT_VECTOR_COLUMN = 2,
+        FLOAT_VECTOR_COLUMN = 3
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  fileName the name of the output file, which is truncated on opening
+     *  @param  treeName the name of the tree, recorded in the file header
+     *  @param  nRowsPerBlock the number of rows to buffer before writing a block
+     */
+    ColumnarTreeWriter(const std::string &fileName, const std::string &treeName, const unsigned int nRowsPerBlock);
+
+    /**
+     *  @brief  Destructor, closes the file if still open
+     */
+    ~ColumnarTreeWriter();
+
+    /**
+     *  @brief  Set the value of a scalar int variable, which is held until the next fill or the next call to set it
+     *
+     *  @param  variableName the variable name
+     *  @param  value the value
+     */
+    void SetVariable(const std::string &variableName, const int value);
+
+    /**
+     *  @brief  Set the value of a scalar float variable, which is held until the next fill or the next call to set it
+     *
+     *  @param  variableName the variable name
+     *  @param  value the value
+     */
+    void SetVariable(const std::string &variableName, const float value);
+
+    /**
+     *  @brief  Set the address of an int vector variable, the contents of which are read at each fill
+     *
+     *  @param  variableName the variable name
+     *  @param  pVector the address of the vector
+     */
+    void SetVariable(const std::string &variableName, const pandora::IntVector *const pVector);
+
+    /**
+     *  @brief  Set the address of a float vector variable, the contents of which are read at each fill
+     *
+     *  @param  variableName the variable name
+     *  @param  pVector the address of the vector
+     */
+    void SetVariable(const std::string &variableName, const pandora::FloatVector *const pVector);
+
+    /**
+     *  @brief  Append a row holding the current values of all variables, writing a block if the buffer is full
+     */
+    void Fill();
+
+    /**
+     *  @brief  Write any buffered rows to the file as a single block
+     */
+    void Flush();
+
+    /**
+     *  @brief  Write any buffered rows and close the file, writing the header even if no rows were filled
+     */
+    void Close();
+
+private:
+    /**
+     *  @brief  Column class
+     */
+    class Column
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  name the column name
+         *  @param  type the column type
+         */
+        Column(const std::string &name, const ColumnType type);
+
+        std::string m_name;                         ///< The column name
+        ColumnType m_type;                          ///< The column type
+        int m_intValue;                             ///< The current value, for int columns
+        float m_floatValue;                         ///< The current value, for float columns
+        const pandora::IntVector *m_pIntVector;     ///< The address of the current vector, for int vector columns
+        const pandora::FloatVector *m_pFloatVector; ///< The address of the current vector, for float vector columns
+        pandora::IntVector m_intValues;             ///< The buffered int values
+        pandora::FloatVector m_floatValues;         ///< The buffered float values
+        std::vector<uint32_t> m_sizes;              ///< The buffered vector sizes, for vector columns
+    };
+
+    typedef std::vector<Column> ColumnVector;
+    typedef std::unordered_map<std::string, unsigned int> NameToColumnIndexMap;
+
+    /**
+     *  @brief  Get the column with a specified name, adding it if the schema has not yet been fixed
+     *
+     *  @param  variableName the variable name
+     *  @param  type the expected column type
+     *
+     *  @return the column
+     */
+    Column &GetColumn(const std::string &variableName, const ColumnType type);
+
+    /**
+     *  @brief  Write the file header, describing the schema
+     */
+    void WriteHeader();
+
+    /**
+     *  @brief  Write a string to the file, preceded by its length
+     *
+     *  @param  string the string
+     */
+    void WriteString(const std::string &string);
+
+    /**
+     *  @brief  Write a vector of values to the file as a contiguous array
+     *
+     *  @param  values the vector of values
+     */
+    template <typename T>
+    void WriteValues(const std::vector<T> &values);
+
+    std::ofstream m_file;                        ///< The output file
+    std::string m_treeName;                      ///< The tree name
+    unsigned int m_nRowsPerBlock;                ///< The number of rows to buffer before writing a block
+    unsigned int m_nBufferedRows;                ///< The number of buffered rows
+    bool m_isSchemaFixed;                        ///< Whether the schema has been fixed by the first fill
+    bool m_isHeaderWritten;                      ///< Whether the file header has been written
+    ColumnVector m_columns;                      ///< The columns, in order of first setting
+    NameToColumnIndexMap m_nameToColumnIndexMap; ///< The map from variable name to column index
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_COLUMNAR_TREE_WRITER_H
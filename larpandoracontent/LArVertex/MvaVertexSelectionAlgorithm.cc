@@ -95,8 +95,9 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
     if ((!m_trainingSetMode || m_allowClassifyDuringTraining) && !bestRegionVertices.empty())
     {
         // Use mva to choose the region.
-        const Vertex *const pBestRegionVertex(
-            this->CompareVertices(bestRegionVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap, m_mvaRegion, m_useRPhiFeatureForRegion));
+        SharedFeatureCache sharedFeatureCache;
+        const Vertex *const pBestRegionVertex(this->CompareVertices(
+            bestRegionVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap, sharedFeatureCache, m_mvaRegion, m_useRPhiFeatureForRegion));
 
         // Get all the vertices in the best region.
         VertexVector regionalVertices{pBestRegionVertex};
@@ -115,7 +116,7 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
         {
             // Use mva to choose the vertex and then fine-tune using the RPhi score.
             const Vertex *const pBestVertex(
-                this->CompareVertices(regionalVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap, m_mvaVertex, true));
+                this->CompareVertices(regionalVertices, vertexFeatureInfoMap, eventFeatureList, kdTreeMap, sharedFeatureCache, m_mvaVertex, true));
             this->PopulateFinalVertexScoreList(vertexFeatureInfoMap, pBestVertex, vertexVector, vertexScoreList);
         }
     }
@@ -125,48 +126,44 @@ void MvaVertexSelectionAlgorithm<T>::GetVertexScoreList(const VertexVector &vert
 
 template <typename T>
 const pandora::Vertex *MvaVertexSelectionAlgorithm<T>::CompareVertices(const VertexVector &vertexVector, const VertexFeatureInfoMap &vertexFeatureInfoMap,
-    const LArMvaHelper::MvaFeatureVector &eventFeatureList, const KDTreeMap &kdTreeMap, const T &t, const bool useRPhi) const
+    const LArMvaHelper::MvaFeatureVector &eventFeatureList, const KDTreeMap &kdTreeMap, SharedFeatureCache &sharedFeatureCache, const T &t,
+    const bool useRPhi) const
 {
-    const Vertex *pBestVertex(vertexVector.front());
-    LArMvaHelper::MvaFeatureVector chosenFeatureList;
+    // Build the feature list for each vertex once, rather than for each comparison in which it takes part
+    std::vector<LArMvaHelper::MvaFeatureVector> featureListVector(vertexVector.size());
 
-    VertexFeatureInfo chosenVertexFeatureInfo(vertexFeatureInfoMap.at(pBestVertex));
-    this->AddVertexFeaturesToVector(chosenVertexFeatureInfo, chosenFeatureList, useRPhi);
+    for (unsigned int iVertex = 0; iVertex < vertexVector.size(); ++iVertex)
+        this->AddVertexFeaturesToVector(vertexFeatureInfoMap.at(vertexVector.at(iVertex)), featureListVector.at(iVertex), useRPhi);
 
-    for (const Vertex *const pVertex : vertexVector)
+    unsigned int bestIndex(0);
+
+    for (unsigned int iVertex = 0; iVertex < vertexVector.size(); ++iVertex)
     {
+        const Vertex *const pVertex(vertexVector.at(iVertex));
+        const Vertex *const pBestVertex(vertexVector.at(bestIndex));
+
         if (pVertex == pBestVertex)
             continue;
 
-        LArMvaHelper::MvaFeatureVector featureList;
-        VertexFeatureInfo vertexFeatureInfo(vertexFeatureInfoMap.at(pVertex));
-        this->AddVertexFeaturesToVector(vertexFeatureInfo, featureList, useRPhi);
+        const LArMvaHelper::MvaFeatureVector &featureList(featureListVector.at(iVertex));
+        const LArMvaHelper::MvaFeatureVector &chosenFeatureList(featureListVector.at(bestIndex));
 
         if (!m_legacyVariables)
         {
             LArMvaHelper::MvaFeatureVector sharedFeatureList;
-            float separation(0.f), axisHits(0.f);
-            this->GetSharedFeatures(pVertex, pBestVertex, kdTreeMap, separation, axisHits);
-            VertexSharedFeatureInfo sharedFeatureInfo(separation, axisHits);
-            this->AddSharedFeaturesToVector(sharedFeatureInfo, sharedFeatureList);
+            this->AddSharedFeaturesToVector(this->GetSharedFeatures(pVertex, pBestVertex, kdTreeMap, sharedFeatureCache), sharedFeatureList);
 
             if (LArMvaHelper::Classify(t, eventFeatureList, featureList, chosenFeatureList, sharedFeatureList))
-            {
-                pBestVertex = pVertex;
-                chosenFeatureList = featureList;
-            }
+                bestIndex = iVertex;
         }
         else
         {
             if (LArMvaHelper::Classify(t, eventFeatureList, featureList, chosenFeatureList))
-            {
-                pBestVertex = pVertex;
-                chosenFeatureList = featureList;
-            }
+                bestIndex = iVertex;
         }
     }
 
-    return pBestVertex;
+    return vertexVector.at(bestIndex);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -130,14 +130,23 @@ float RPhiFeatureTool::GetMidwayScore(const KernelEstimate &kernelEstimateU, con
     for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateW.GetContributionList())
         histogramW.Fill(contribution.first, contribution.second);
 
+    FloatVector binCenters;
+
+    for (int xBin = 0; xBin < histogramU.GetNBinsX(); ++xBin)
+        binCenters.push_back(histogramU.GetXLow() + (static_cast<float>(xBin) + 0.5f) * histogramU.GetXBinWidth());
+
+    FloatVector samplesU, samplesV, samplesW;
+    kernelEstimateU.Sample(binCenters, samplesU);
+    kernelEstimateV.Sample(binCenters, samplesV);
+    kernelEstimateW.Sample(binCenters, samplesW);
+
     float figureOfMerit(0.f);
 
     for (int xBin = 0; xBin < histogramU.GetNBinsX(); ++xBin)
     {
-        const float binCenter(histogramU.GetXLow() + (static_cast<float>(xBin) + 0.5f) * histogramU.GetXBinWidth());
-        figureOfMerit += histogramU.GetBinContent(xBin) * kernelEstimateU.Sample(binCenter);
-        figureOfMerit += histogramV.GetBinContent(xBin) * kernelEstimateV.Sample(binCenter);
-        figureOfMerit += histogramW.GetBinContent(xBin) * kernelEstimateW.Sample(binCenter);
+        figureOfMerit += histogramU.GetBinContent(xBin) * samplesU.at(xBin);
+        figureOfMerit += histogramV.GetBinContent(xBin) * samplesV.at(xBin);
+        figureOfMerit += histogramW.GetBinContent(xBin) * samplesW.at(xBin);
     }
 
     return figureOfMerit;
@@ -148,15 +157,22 @@ float RPhiFeatureTool::GetMidwayScore(const KernelEstimate &kernelEstimateU, con
 float RPhiFeatureTool::GetFullScore(const KernelEstimate &kernelEstimateU, const KernelEstimate &kernelEstimateV, const KernelEstimate &kernelEstimateW) const
 {
     float figureOfMerit(0.f);
+    FloatVector xValues, samples;
 
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateU.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateU.Sample(contribution.first);
+    for (const KernelEstimate *const pKernelEstimate : {&kernelEstimateU, &kernelEstimateV, &kernelEstimateW})
+    {
+        const KernelEstimate::ContributionList &contributionList(pKernelEstimate->GetContributionList());
 
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateV.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateV.Sample(contribution.first);
+        xValues.clear();
 
-    for (const KernelEstimate::ContributionList::value_type &contribution : kernelEstimateW.GetContributionList())
-        figureOfMerit += contribution.second * kernelEstimateW.Sample(contribution.first);
+        for (const KernelEstimate::ContributionList::value_type &contribution : contributionList)
+            xValues.push_back(contribution.first);
+
+        pKernelEstimate->Sample(xValues, samples);
+
+        for (unsigned int iContribution = 0; iContribution < contributionList.size(); ++iContribution)
+            figureOfMerit += contributionList.at(iContribution).second * samples.at(iContribution);
+    }
 
     return figureOfMerit;
 }
@@ -215,13 +231,62 @@ float RPhiFeatureTool::atan2Fast(const float y, const float x) const
 float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 {
     const ContributionList &contributionList(this->GetContributionList());
-    ContributionList::const_iterator lowerIter(contributionList.lower_bound(x - 3.f * m_sigma));
-    ContributionList::const_iterator upperIter(contributionList.upper_bound(x + 3.f * m_sigma));
+    ContributionList::const_iterator lowerIter(std::lower_bound(contributionList.begin(), contributionList.end(), x - 3.f * m_sigma,
+        [](const ContributionList::value_type &contribution, const float value) { return contribution.first < value; }));
+    ContributionList::const_iterator upperIter(std::upper_bound(contributionList.begin(), contributionList.end(), x + 3.f * m_sigma,
+        [](const float value, const ContributionList::value_type &contribution) { return value < contribution.first; }));
+
+    return this->Sample(x, lowerIter, upperIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::KernelEstimate::Sample(const FloatVector &xValues, FloatVector &samples) const
+{
+    const ContributionList &contributionList(this->GetContributionList());
+    ContributionList::const_iterator lowerIter(contributionList.begin()), upperIter(contributionList.begin());
+
+    samples.clear();
+    samples.reserve(xValues.size());
+
+    for (const float x : xValues)
+    {
+        if (!samples.empty() && (x < xValues.at(samples.size() - 1)))
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        // ATTN Positions are ascending, so the +-3 sigma window of contributions only moves forwards, selecting the same range as Sample(x)
+        const float xLow(x - 3.f * m_sigma), xHigh(x + 3.f * m_sigma);
 
+        while ((contributionList.end() != lowerIter) && (lowerIter->first < xLow))
+            ++lowerIter;
+
+        if (upperIter < lowerIter)
+            upperIter = lowerIter;
+
+        while ((contributionList.end() != upperIter) && !(xHigh < upperIter->first))
+            ++upperIter;
+
+        samples.push_back(this->Sample(x, lowerIter, upperIter));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::KernelEstimate::AddContribution(const float x, const float weight)
+{
+    m_contributionList.emplace_back(x, weight);
+    m_isSorted = false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float RPhiFeatureTool::KernelEstimate::Sample(
+    const float x, const ContributionList::const_iterator beginIter, const ContributionList::const_iterator endIter) const
+{
     float sample(0.f);
     const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
 
-    for (ContributionList::const_iterator iter = lowerIter; iter != upperIter; ++iter)
+    for (ContributionList::const_iterator iter = beginIter; iter != endIter; ++iter)
     {
         const float deltaSigma((x - iter->first) / m_sigma);
         const float gaussian(gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
@@ -233,13 +298,6 @@ float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void RPhiFeatureTool::KernelEstimate::AddContribution(const float x, const float weight)
-{
-    m_contributionList.insert(ContributionList::value_type(x, weight));
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 StatusCode RPhiFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "FastScoreCheck", m_fastScoreCheck));
@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+
 namespace lar_content
 {
 
@@ -65,12 +67,20 @@ private:
          */
         float Sample(const float x) const;
 
-        typedef std::multimap<float, float> ContributionList; ///< Map from x coord to weight, ATTN avoid map.find, etc. with float key
+        /**
+         *  @brief  Sample the parameterised distribution at a list of x coordinates, in a single pass over the contributions
+         *
+         *  @param  xValues the positions at which to sample, which must be in ascending order
+         *  @param  samples to receive the sample values, in the order of the positions
+         */
+        void Sample(const pandora::FloatVector &xValues, pandora::FloatVector &samples) const;
+
+        typedef std::vector<std::pair<float, float>> ContributionList; ///< List of (x coord, weight) pairs, stably sorted by x coord on access
 
         /**
          *  @brief  Get the contribution list
          *
-         *  @return the contribution list
+         *  @return the contribution list, sorted by x coord
          */
         const ContributionList &GetContributionList() const;
 
@@ -90,8 +100,20 @@ private:
         void AddContribution(const float x, const float weight);
 
     private:
-        ContributionList m_contributionList; ///< The contribution list
-        const float m_sigma;                 ///< The assigned width
+        /**
+         *  @brief  Sample the parameterised distribution at a specified x coordinate, using a specified range of contributions
+         *
+         *  @param  x the position at which to sample
+         *  @param  beginIter iterator to the first contribution in the range
+         *  @param  endIter iterator past the last contribution in the range
+         *
+         *  @return the sample value
+         */
+        float Sample(const float x, const ContributionList::const_iterator beginIter, const ContributionList::const_iterator endIter) const;
+
+        mutable ContributionList m_contributionList; ///< The contribution list
+        mutable bool m_isSorted;                     ///< Whether the contribution list is sorted by x coord
+        const float m_sigma;                         ///< The assigned width
     };
 
     //--------------------------------------------------------------------------------------------------------------------------------------
@@ -180,7 +202,7 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) : m_sigma(sigma)
+inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) : m_isSorted(true), m_sigma(sigma)
 {
     if (m_sigma < std::numeric_limits<float>::epsilon())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
@@ -190,6 +212,14 @@ inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) : m_si
 
 inline const RPhiFeatureTool::KernelEstimate::ContributionList &RPhiFeatureTool::KernelEstimate::GetContributionList() const
 {
+    // ATTN Stable sort retains insertion order for equal x coords, as for the equivalent multimap
+    if (!m_isSorted)
+    {
+        std::stable_sort(m_contributionList.begin(), m_contributionList.end(),
+            [](const ContributionList::value_type &lhs, const ContributionList::value_type &rhs) { return lhs.first < rhs.first; });
+        m_isSorted = true;
+    }
+
     return m_contributionList;
 }
 
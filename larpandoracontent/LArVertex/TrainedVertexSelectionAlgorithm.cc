@@ -688,18 +688,56 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
 void TrainedVertexSelectionAlgorithm::GetSharedFeatures(
     const Vertex *const pVertex1, const Vertex *const pVertex2, const KDTreeMap &kdTreeMap, float &separation, float &axisHits) const
 {
-    separation = (pVertex1->GetPosition() - pVertex2->GetPosition()).GetMagnitude();
+    SharedFeatureCache sharedFeatureCache;
+    const VertexSharedFeatureInfo &sharedFeatureInfo(this->GetSharedFeatures(pVertex1, pVertex2, kdTreeMap, sharedFeatureCache));
 
-    this->IncrementSharedAxisValues(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex1->GetPosition(), TPC_VIEW_U),
-        LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex2->GetPosition(), TPC_VIEW_U), kdTreeMap.at(TPC_VIEW_U), axisHits);
+    separation = sharedFeatureInfo.m_separation;
+    axisHits = sharedFeatureInfo.m_axisHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const TrainedVertexSelectionAlgorithm::VertexSharedFeatureInfo &TrainedVertexSelectionAlgorithm::GetSharedFeatures(
+    const Vertex *const pVertex1, const Vertex *const pVertex2, const KDTreeMap &kdTreeMap, SharedFeatureCache &sharedFeatureCache) const
+{
+    // ATTN: The axis hit count depends on the order of the vertices at the level of rounding, so the pair is not symmetrised
+    const VertexSharedFeatureInfoMap::key_type vertexPair(pVertex1, pVertex2);
+    const VertexSharedFeatureInfoMap::const_iterator cacheIter(sharedFeatureCache.m_vertexSharedFeatureInfoMap.find(vertexPair));
 
-    this->IncrementSharedAxisValues(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex1->GetPosition(), TPC_VIEW_V),
-        LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex2->GetPosition(), TPC_VIEW_V), kdTreeMap.at(TPC_VIEW_V), axisHits);
+    if (sharedFeatureCache.m_vertexSharedFeatureInfoMap.end() != cacheIter)
+        return cacheIter->second;
 
-    this->IncrementSharedAxisValues(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex1->GetPosition(), TPC_VIEW_W),
-        LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex2->GetPosition(), TPC_VIEW_W), kdTreeMap.at(TPC_VIEW_W), axisHits);
+    const CartesianPointVector &projectedPositions1(this->GetProjectedPositions(pVertex1, sharedFeatureCache));
+    const CartesianPointVector &projectedPositions2(this->GetProjectedPositions(pVertex2, sharedFeatureCache));
+
+    const float separation((pVertex1->GetPosition() - pVertex2->GetPosition()).GetMagnitude());
+    float axisHits(0.f);
+
+    this->IncrementSharedAxisValues(projectedPositions1.at(0), projectedPositions2.at(0), kdTreeMap.at(TPC_VIEW_U), axisHits);
+    this->IncrementSharedAxisValues(projectedPositions1.at(1), projectedPositions2.at(1), kdTreeMap.at(TPC_VIEW_V), axisHits);
+    this->IncrementSharedAxisValues(projectedPositions1.at(2), projectedPositions2.at(2), kdTreeMap.at(TPC_VIEW_W), axisHits);
 
     axisHits = separation > std::numeric_limits<float>::epsilon() ? axisHits / separation : 0.f;
+
+    return sharedFeatureCache.m_vertexSharedFeatureInfoMap.emplace(vertexPair, VertexSharedFeatureInfo(separation, axisHits)).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CartesianPointVector &TrainedVertexSelectionAlgorithm::GetProjectedPositions(
+    const Vertex *const pVertex, SharedFeatureCache &sharedFeatureCache) const
+{
+    const VertexProjectionMap::const_iterator cacheIter(sharedFeatureCache.m_vertexProjectionMap.find(pVertex));
+
+    if (sharedFeatureCache.m_vertexProjectionMap.end() != cacheIter)
+        return cacheIter->second;
+
+    CartesianPointVector projectedPositions;
+
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+        projectedPositions.push_back(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
+
+    return sharedFeatureCache.m_vertexProjectionMap.emplace(pVertex, projectedPositions).first->second;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -89,6 +89,19 @@ public:
         float m_axisHits;   ///< The hit density along the axis between the two vertices
     };
 
+    typedef std::unordered_map<const pandora::Vertex *, pandora::CartesianPointVector> VertexProjectionMap;
+    typedef std::map<std::pair<const pandora::Vertex *, const pandora::Vertex *>, VertexSharedFeatureInfo> VertexSharedFeatureInfoMap;
+
+    /**
+     *  @brief Shared feature cache class, memoising the per-vertex and per-pair inputs to the shared features within an event
+     */
+    class SharedFeatureCache
+    {
+    public:
+        VertexProjectionMap m_vertexProjectionMap;               ///< The vertex positions projected into the U, V and W views
+        VertexSharedFeatureInfoMap m_vertexSharedFeatureInfoMap; ///< The shared features, keyed by the ordered pair of vertices
+    };
+
     //--------------------------------------------------------------------------------------------------------------------------------------
 
     /**
@@ -395,6 +408,30 @@ protected:
     void GetSharedFeatures(const pandora::Vertex *const pVertex1, const pandora::Vertex *const pVertex2, const KDTreeMap &kdTreeMap,
         float &separation, float &axisHits) const;
 
+    /**
+     *  @brief  Get the shared features of a pair of vertex candidates, calculating them only if absent from the cache
+     *
+     *  @param  pVertex1 the address of the first vertex
+     *  @param  pVertex2 the address of the second vertex
+     *  @param  kdTreeMap the map of 2D hit kd trees, which must be unchanged for the lifetime of the cache
+     *  @param  sharedFeatureCache the shared feature cache
+     *
+     *  @return the shared vertex feature info
+     */
+    const VertexSharedFeatureInfo &GetSharedFeatures(const pandora::Vertex *const pVertex1, const pandora::Vertex *const pVertex2,
+        const KDTreeMap &kdTreeMap, SharedFeatureCache &sharedFeatureCache) const;
+
+    /**
+     *  @brief  Get the positions of a vertex projected into the U, V and W views, calculating them only if absent from the cache
+     *
+     *  @param  pVertex the address of the vertex
+     *  @param  sharedFeatureCache the shared feature cache
+     *
+     *  @return the projected positions, in U, V, W order
+     */
+    const pandora::CartesianPointVector &GetProjectedPositions(
+        const pandora::Vertex *const pVertex, SharedFeatureCache &sharedFeatureCache) const;
+
     /**
      *  @brief  Increments the axis hits information for one view
      *
@@ -8,17 +8,43 @@
 
 #include "larpandoradlcontent/LArHelpers/LArDLHelper.h"
 
+#include <chrono>
+
 namespace lar_dl_content
 {
 
 using namespace pandora;
 
-StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::TorchModel &model)
+StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::TorchModel &model, const bool optimiseForInference)
 {
+    ModelCache &modelCache(LArDLHelper::GetModelCache());
+    const std::lock_guard<std::mutex> lock(modelCache.m_mutex);
+
+    const TorchModelKey key(filename, optimiseForInference);
+    TorchModelMap::const_iterator iter(modelCache.m_modelMap.find(key));
+
+    if (modelCache.m_modelMap.end() != iter)
+    {
+        // Copies of a script module share the underlying object, so no weights are duplicated here
+        model = iter->second.m_model;
+        return STATUS_CODE_SUCCESS;
+    }
+
     try
     {
+        const auto start{std::chrono::steady_clock::now()};
         model = torch::jit::load(filename);
-        std::cout << "Loaded the TorchScript model \'" << filename << "\'" << std::endl;
+
+        if (optimiseForInference)
+        {
+            model.eval();
+            model = torch::jit::optimize_for_inference(model);
+        }
+
+        const std::chrono::duration<double, std::milli> loadTime{std::chrono::steady_clock::now() - start};
+        modelCache.m_modelMap.emplace(key, CachedModel(model));
+        std::cout << "Loaded the TorchScript model \'" << filename << "\'" << (optimiseForInference ? " (optimised for inference)" : "") << " in "
+                  << loadTime.count() << " ms" << std::endl;
     }
     catch (...)
     {
@@ -31,6 +57,19 @@ StatusCode LArDLHelper::LoadModel(const std::string &filename, LArDLHelper::Torc
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode LArDLHelper::SetIntraOpThreads(const int nThreads)
+{
+    if (nThreads <= 0)
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    if (at::get_num_threads() != nThreads)
+        at::set_num_threads(nThreads);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArDLHelper::InitialiseInput(const at::IntArrayRef dimensions, TorchInput &tensor)
 {
     tensor = torch::zeros(dimensions);
@@ -40,7 +79,60 @@ void LArDLHelper::InitialiseInput(const at::IntArrayRef dimensions, TorchInput &
 
 void LArDLHelper::Forward(TorchModel &model, const TorchInputVector &input, TorchOutput &output)
 {
+    const torch::InferenceMode guard;
     output = model.forward(input).toTensor();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::WarmUp(TorchModel &model, const at::IntArrayRef dimensions, const unsigned int nPasses)
+{
+    if (0 == nPasses)
+        return;
+
+    ModelCache &modelCache(LArDLHelper::GetModelCache());
+    const std::lock_guard<std::mutex> lock(modelCache.m_mutex);
+
+    // ATTN Copies of a script module share the underlying object, which identifies the cached model. Models not from the cache are always
+    // warmed up. The lock is held throughout, so concurrent requests for the same model wait for the first warm-up, then skip their own
+    for (TorchModelMap::value_type &mapEntry : modelCache.m_modelMap)
+    {
+        if (mapEntry.second.m_model._ivalue() != model._ivalue())
+            continue;
+
+        if (!mapEntry.second.m_warmedUpShapes.insert(dimensions.vec()).second)
+            return;
+
+        break;
+    }
+
+    TorchInput input;
+    LArDLHelper::InitialiseInput(dimensions, input);
+
+    TorchInputVector inputs;
+    inputs.push_back(input);
+
+    for (unsigned int pass = 0; pass < nPasses; ++pass)
+    {
+        TorchOutput output;
+        LArDLHelper::Forward(model, inputs, output);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArDLHelper::ModelCache &LArDLHelper::GetModelCache()
+{
+    static ModelCache modelCache;
+    return modelCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArDLHelper::CachedModel::CachedModel(const TorchModel &model) :
+    m_model(model)
+{
+}
+
 } // namespace lar_dl_content
@@ -13,6 +13,10 @@
 
 #include "Pandora/StatusCodes.h"
 
+#include <map>
+#include <mutex>
+#include <set>
+
 namespace lar_dl_content
 {
 
@@ -28,14 +32,25 @@ public:
     typedef at::Tensor TorchOutput;
 
     /**
-     *  @brief  Loads a deep learning model
+     *  @brief  Loads a deep learning model. Models are held in a process-wide cache, keyed by filename, so each file is only read once and
+     *          the underlying module is shared, read-only, between all algorithm instances (in all Pandora instances) requesting it
      *
      *  @param  filename the filename of the model to load
      *  @param  model the TorchModel in which to store the loaded model
+     *  @param  optimiseForInference whether to switch the model to evaluation mode, then freeze and optimise it for inference
      *
      *  @return STATUS_CODE_SUCCESS upon successful loading of the model. STATUS_CODE_FAILURE otherwise.
      */
-    static pandora::StatusCode LoadModel(const std::string &filename, TorchModel &model);
+    static pandora::StatusCode LoadModel(const std::string &filename, TorchModel &model, const bool optimiseForInference = false);
+
+    /**
+     *  @brief  Set the number of threads available to libtorch for intra-op parallelism. This is a process-wide setting.
+     *
+     *  @param  nThreads the number of threads, must be positive
+     *
+     *  @return STATUS_CODE_SUCCESS upon success, STATUS_CODE_INVALID_PARAMETER if the number of threads is not positive
+     */
+    static pandora::StatusCode SetIntraOpThreads(const int nThreads);
 
     /**
      *  @brief  Create a torch input tensor
@@ -46,13 +61,64 @@ public:
     static void InitialiseInput(const at::IntArrayRef dimensions, TorchInput &tensor);
 
     /**
-     *  @brief  Run a deep learning model
+     *  @brief  Run a deep learning model, with autograd tracking disabled
      *
      *  @param  model the model to run
      *  @param  input the input to run over
      *  @param  output the tensor to store the output in
      */
     static void Forward(TorchModel &model, const TorchInputVector &input, TorchOutput &output);
+
+    /**
+     *  @brief  Warm up a deep learning model by running it over blank input, so that the one-off profiling and optimisation costs of the
+     *          JIT are paid during initialisation, rather than during event processing. A cached model is only warmed up once for each
+     *          input shape, however many algorithm instances share it
+     *
+     *  @param  model the model to warm up
+     *  @param  dimensions the size of each dimension of the representative input tensor: pass as {a, b, c, d} for example
+     *  @param  nPasses the number of warm-up passes to run
+     */
+    static void WarmUp(TorchModel &model, const at::IntArrayRef dimensions, const unsigned int nPasses);
+
+private:
+    typedef std::pair<std::string, bool> TorchModelKey;
+    typedef std::set<std::vector<int64_t>> InputShapeSet;
+
+    /**
+     *  @brief  CachedModel class, a loaded model and the input shapes for which it has been warmed up
+     */
+    class CachedModel
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  model the loaded model
+         */
+        CachedModel(const TorchModel &model);
+
+        TorchModel m_model;             ///< The loaded model
+        InputShapeSet m_warmedUpShapes; ///< The input shapes for which the model has been warmed up
+    };
+
+    typedef std::map<TorchModelKey, CachedModel> TorchModelMap;
+
+    /**
+     *  @brief  ModelCache class, the process-wide registry of loaded models
+     */
+    class ModelCache
+    {
+    public:
+        std::mutex m_mutex;       ///< The mutex guarding access to the model map
+        TorchModelMap m_modelMap; ///< The map from model filename (and inference optimisation flag) to loaded model
+    };
+
+    /**
+     *  @brief  Get the process-wide model cache
+     *
+     *  @return the model cache
+     */
+    static ModelCache &GetModelCache();
 };
 
 } // namespace lar_dl_content
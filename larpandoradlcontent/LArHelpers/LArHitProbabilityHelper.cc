@@ -0,0 +1,49 @@
+/**
+ *  @file   larpandoradlcontent/LArHelpers/LArHitProbabilityHelper.cc
+ *
+ *  @brief  Implementation of the lar hit probability helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoradlcontent/LArHelpers/LArHitProbabilityHelper.h"
+
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+
+using namespace pandora;
+using namespace lar_content;
+
+namespace lar_dl_content
+{
+
+void LArHitProbabilityHelper::TrackLikelihoodSum::AddCluster(const Cluster *const pCluster)
+{
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+        this->AddCaloHits(*layerEntry.second);
+
+    this->AddCaloHits(pCluster->GetIsolatedCaloHitList());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArHitProbabilityHelper::TrackLikelihoodSum::AddCaloHits(const CaloHitList &caloHitList)
+{
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        const LArCaloHit *const pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
+
+        if (!pLArCaloHit)
+            throw StatusCodeException(STATUS_CODE_INVALID_TYPE);
+
+        const float pTrack{pLArCaloHit->GetTrackProbability()};
+        const float pShower{pLArCaloHit->GetShowerProbability()};
+
+        if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
+        {
+            m_sum += pTrack / (pTrack + pShower);
+            ++m_nHits;
+        }
+    }
+}
+
+} // namespace lar_dl_content
@@ -0,0 +1,95 @@
+/**
+ *  @file   larpandoradlcontent/LArHelpers/LArHitProbabilityHelper.h
+ *
+ *  @brief  Header file for the lar hit probability helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_HIT_PROBABILITY_HELPER_H
+#define LAR_HIT_PROBABILITY_HELPER_H 1
+
+#include "Objects/Cluster.h"
+
+namespace lar_dl_content
+{
+
+/**
+ *  @brief  LArHitProbabilityHelper class
+ */
+class LArHitProbabilityHelper
+{
+public:
+    /**
+     *  @brief  TrackLikelihoodSum class, accumulating the track likelihood, pTrack / (pTrack + pShower), of hits with a valid probability
+     */
+    class TrackLikelihoodSum
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        TrackLikelihoodSum();
+
+        /**
+         *  @brief  Get the number of hits contributing to the sum
+         *
+         *  @return the number of hits
+         */
+        unsigned long GetNHits() const;
+
+        /**
+         *  @brief  Get the mean track likelihood of the contributing hits
+         *
+         *  @return the mean track likelihood
+         */
+        float GetMean() const;
+
+        /**
+         *  @brief  Add the hits of a cluster, ordered hits first (in layer order) then isolated hits. Throws (leaving the contributions of any
+         *          hits already visited in place) if a hit is not a LArCaloHit
+         *
+         *  @param  pCluster address of the cluster
+         */
+        void AddCluster(const pandora::Cluster *const pCluster);
+
+    private:
+        /**
+         *  @brief  Add the hits in a calo hit list
+         *
+         *  @param  caloHitList the calo hit list
+         */
+        void AddCaloHits(const pandora::CaloHitList &caloHitList);
+
+        float m_sum;           ///< The sum of hit track likelihoods, accumulated in hit order
+        unsigned long m_nHits; ///< The number of contributing hits
+    };
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArHitProbabilityHelper::TrackLikelihoodSum::TrackLikelihoodSum() :
+    m_sum(0.f),
+    m_nHits(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned long LArHitProbabilityHelper::TrackLikelihoodSum::GetNHits() const
+{
+    return m_nHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline float LArHitProbabilityHelper::TrackLikelihoodSum::GetMean() const
+{
+    if (0 == m_nHits)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_INITIALIZED);
+
+    return m_sum / m_nHits;
+}
+
+} // namespace lar_dl_content
+
+#endif // #ifndef LAR_HIT_PROBABILITY_HELPER_H
@@ -8,12 +8,9 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoradlcontent/LArHelpers/LArHitProbabilityHelper.h"
 #include "larpandoradlcontent/LArTrackShowerId/DlClusterCharacterisationAlgorithm.h"
 
-#include "larpandoracontent/LArObjects/LArCaloHit.h"
-
-#include <numeric>
-
 using namespace pandora;
 using namespace lar_content;
 
@@ -34,32 +31,13 @@ DlClusterCharacterisationAlgorithm::~DlClusterCharacterisationAlgorithm()
 
 bool DlClusterCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster) const
 {
-    const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-    CaloHitList caloHits;
-    orderedCaloHitList.FillCaloHitList(caloHits);
-    const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-    caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
-    FloatVector trackLikelihoods;
     try
     {
-        for (const CaloHit *pCaloHit : caloHits)
-        {
-            const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-            const float pTrack{pLArCaloHit->GetTrackProbability()};
-            const float pShower{pLArCaloHit->GetShowerProbability()};
-            if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-        }
+        LArHitProbabilityHelper::TrackLikelihoodSum trackLikelihoodSum;
+        trackLikelihoodSum.AddCluster(pCluster);
 
-        const unsigned long N{trackLikelihoods.size()};
-        if (N > 0)
-        {
-            float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
-            if (mean >= 0.5f)
-                return true;
-            else
-                return false;
-        }
+        if (trackLikelihoodSum.GetNHits() > 0)
+            return (trackLikelihoodSum.GetMean() >= 0.5f);
     }
     catch (const StatusCodeException &)
     {
@@ -30,6 +30,10 @@ namespace lar_dl_content
 {
 
 DlHitTrackShowerIdAlgorithm::DlHitTrackShowerIdAlgorithm() :
+    m_nIntraOpThreads(0),
+    m_optimiseForInference(false),
+    m_nWarmUpPasses(0),
+    m_reportInferenceTiming(false),
     m_imageHeight(256),
     m_imageWidth(256),
     m_tileSize(128.f),
@@ -176,6 +180,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
         float **weights = new float *[m_imageHeight];
         for (int r = 0; r < m_imageHeight; ++r)
             weights[r] = new float[m_imageWidth]();
+        std::chrono::duration<double, std::milli> inferenceTime{0.};
         for (int i = 0; i < nTiles; ++i)
         {
             for (const CaloHit *pCaloHit : *pCaloHitList)
@@ -248,7 +253,16 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
             LArDLHelper::TorchInputVector inputs;
             inputs.push_back(input);
             LArDLHelper::TorchOutput output;
-            LArDLHelper::Forward(model, inputs, output);
+            if (m_reportInferenceTiming)
+            {
+                const auto start{std::chrono::steady_clock::now()};
+                LArDLHelper::Forward(model, inputs, output);
+                inferenceTime += std::chrono::steady_clock::now() - start;
+            }
+            else
+            {
+                LArDLHelper::Forward(model, inputs, output);
+            }
             auto outputAccessor = output.accessor<float, 4>();
 
             for (const CaloHit *pCaloHit : *pCaloHitList)
@@ -289,6 +303,12 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
             delete[] weights[r];
         delete[] weights;
 
+        if (m_reportInferenceTiming && (nTiles > 0))
+        {
+            std::cout << "DlHitTrackShowerIdAlgorithm: " << listName << ", " << nTiles << " tiles, mean inference latency per tile "
+                      << (inferenceTime.count() / nTiles) << " ms" << std::endl;
+        }
+
         if (m_visualize)
         {
             const std::string trackListName("TrackHits_" + listName);
@@ -372,13 +392,23 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
     }
     else
     {
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NIntraOpThreads", m_nIntraOpThreads));
+        if (m_nIntraOpThreads > 0)
+        {
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::SetIntraOpThreads(m_nIntraOpThreads));
+        }
+
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "OptimiseForInference", m_optimiseForInference));
+
         bool modelLoaded{false};
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ModelFileNameU", m_modelFileNameU));
         if (!m_modelFileNameU.empty())
         {
             m_modelFileNameU = LArFileHelper::FindFileInPath(m_modelFileNameU, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameU, m_modelU));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameU, m_modelU, m_optimiseForInference));
             modelLoaded = true;
         }
         PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -386,7 +416,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         if (!m_modelFileNameV.empty())
         {
             m_modelFileNameV = LArFileHelper::FindFileInPath(m_modelFileNameV, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameV, m_modelV));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameV, m_modelV, m_optimiseForInference));
             modelLoaded = true;
         }
         PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -394,7 +424,7 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         if (!m_modelFileNameW.empty())
         {
             m_modelFileNameW = LArFileHelper::FindFileInPath(m_modelFileNameW, "FW_SEARCH_PATH");
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameW, m_modelW));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArDLHelper::LoadModel(m_modelFileNameW, m_modelW, m_optimiseForInference));
             modelLoaded = true;
         }
         if (!modelLoaded)
@@ -415,6 +445,22 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         return STATUS_CODE_INVALID_PARAMETER;
     }
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Visualize", m_visualize));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ReportInferenceTiming", m_reportInferenceTiming));
+
+    if (!m_useTrainingMode)
+    {
+        PANDORA_RETURN_RESULT_IF_AND_IF(
+            STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NWarmUpPasses", m_nWarmUpPasses));
+
+        // Warm up with a tile of the same shape as used in event processing
+        if (!m_modelFileNameU.empty())
+            LArDLHelper::WarmUp(m_modelU, {1, 1, m_imageHeight, m_imageWidth}, m_nWarmUpPasses);
+        if (!m_modelFileNameV.empty())
+            LArDLHelper::WarmUp(m_modelV, {1, 1, m_imageHeight, m_imageWidth}, m_nWarmUpPasses);
+        if (!m_modelFileNameW.empty())
+            LArDLHelper::WarmUp(m_modelW, {1, 1, m_imageHeight, m_imageWidth}, m_nWarmUpPasses);
+    }
 
     return STATUS_CODE_SUCCESS;
 }
@@ -74,6 +74,10 @@ private:
     LArDLHelper::TorchModel m_modelU;         ///< Model for the U view
     LArDLHelper::TorchModel m_modelV;         ///< Model for the V view
     LArDLHelper::TorchModel m_modelW;         ///< Model for the W view
+    int m_nIntraOpThreads;                    ///< Number of libtorch intra-op threads (process-wide), if positive
+    bool m_optimiseForInference;              ///< Whether to freeze and optimise the models for inference at load time
+    unsigned int m_nWarmUpPasses;             ///< Number of warm-up passes over blank tiles to run for each model during initialisation
+    bool m_reportInferenceTiming;             ///< Whether to report the mean inference latency per tile
     int m_imageHeight;                        ///< Height of images in pixels
     int m_imageWidth;                         ///< Width of images in pixels
     float m_tileSize;                         ///< Size of tile in cm
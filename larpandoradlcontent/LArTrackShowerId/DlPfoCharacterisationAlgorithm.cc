@@ -9,12 +9,10 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
-#include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include "larpandoradlcontent/LArHelpers/LArHitProbabilityHelper.h"
 #include "larpandoradlcontent/LArTrackShowerId/DlPfoCharacterisationAlgorithm.h"
 
-#include <numeric>
-
 using namespace pandora;
 using namespace lar_content;
 
@@ -29,32 +27,13 @@ DlPfoCharacterisationAlgorithm::DlPfoCharacterisationAlgorithm()
 
 bool DlPfoCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster) const
 {
-    const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-    CaloHitList caloHits;
-    orderedCaloHitList.FillCaloHitList(caloHits);
-    const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-    caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
-    FloatVector trackLikelihoods;
     try
     {
-        for (const CaloHit *pCaloHit : caloHits)
-        {
-            const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-            const float pTrack{pLArCaloHit->GetTrackProbability()};
-            const float pShower{pLArCaloHit->GetShowerProbability()};
-            if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-        }
+        LArHitProbabilityHelper::TrackLikelihoodSum trackLikelihoodSum;
+        trackLikelihoodSum.AddCluster(pCluster);
 
-        const unsigned long N{trackLikelihoods.size()};
-        if (N > 0)
-        {
-            float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
-            if (mean >= 0.5f)
-                return true;
-            else
-                return false;
-        }
+        if (trackLikelihoodSum.GetNHits() > 0)
+            return (trackLikelihoodSum.GetMean() >= 0.5f);
     }
     catch (const StatusCodeException &)
     {
@@ -69,39 +48,21 @@ bool DlPfoCharacterisationAlgorithm::IsClearTrack(const pandora::ParticleFlowObj
 {
     ClusterList allClusters;
     LArPfoHelper::GetTwoDClusterList(pPfo, allClusters);
-    FloatVector trackLikelihoods;
+    LArHitProbabilityHelper::TrackLikelihoodSum trackLikelihoodSum;
     for (const Cluster *pCluster : allClusters)
     {
-        const OrderedCaloHitList &orderedCaloHitList{pCluster->GetOrderedCaloHitList()};
-        CaloHitList caloHits;
-        orderedCaloHitList.FillCaloHitList(caloHits);
-        const CaloHitList &isolatedHits{pCluster->GetIsolatedCaloHitList()};
-        caloHits.insert(caloHits.end(), isolatedHits.begin(), isolatedHits.end());
+        // ATTN Contributions from hits preceding a failure within a cluster are retained
         try
         {
-            for (const CaloHit *pCaloHit : caloHits)
-            {
-                const LArCaloHit *pLArCaloHit{dynamic_cast<const LArCaloHit *>(pCaloHit)};
-                const float pTrack{pLArCaloHit->GetTrackProbability()};
-                const float pShower{pLArCaloHit->GetShowerProbability()};
-                if ((pTrack + pShower) > std::numeric_limits<float>::epsilon())
-                    trackLikelihoods.emplace_back(pTrack / (pTrack + pShower));
-            }
+            trackLikelihoodSum.AddCluster(pCluster);
         }
         catch (const StatusCodeException &)
         {
         }
     }
 
-    const unsigned long N{trackLikelihoods.size()};
-    if (N > 0)
-    {
-        float mean{std::accumulate(std::begin(trackLikelihoods), std::end(trackLikelihoods), 0.f) / N};
-        if (mean >= 0.5f)
-            return true;
-        else
-            return false;
-    }
+    if (trackLikelihoodSum.GetNHits() > 0)
+        return (trackLikelihoodSum.GetMean() >= 0.5f);
 
     return true;
 }